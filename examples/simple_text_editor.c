@@ -2,49 +2,90 @@
 #include <string.h>
 #include <stdlib.h>
 
-#define MAX_TEXT_SIZE 1024
 #define FONT_SIZE 20
+#define WRAP_WIDTH 780
 
 typedef struct {
-    char text[MAX_TEXT_SIZE];
-    int cursor;
+    TextView view;
+    int line;
+    int column;
+    float scroll;
 } TextEditor;
 
 void initTextEditor(TextEditor *editor) {
-    memset(editor->text, 0, sizeof(editor->text));
-    editor->cursor = 0;
+    editor->view = LoadTextView(GetFontDefault(), "", FONT_SIZE, 2, WRAP_WIDTH);
+    editor->line = 0;
+    editor->column = 0;
+    editor->scroll = 0;
 }
 
 void drawTextEditor(TextEditor *editor) {
     ClearBackground(RAYWHITE);
-    DrawText(editor->text, 10, 10, FONT_SIZE, BLACK);
+
+    // Only lines visible on screen are drawn
+    Rectangle bounds = { 10, 10, WRAP_WIDTH, (float)GetScreenHeight() - 20 };
+    DrawTextView(editor->view, bounds, editor->scroll, BLACK);
 
     // Draw cursor
-    int cursorX = 10 + MeasureText(editor->text, FONT_SIZE);
-    DrawRectangle(cursorX, 10, 2, FONT_SIZE, BLACK);
+    Vector2 cursor = GetTextViewPosition(editor->view, editor->line, editor->column);
+    DrawRectangle(10 + (int)cursor.x, 10 + (int)(cursor.y - editor->scroll), 2, FONT_SIZE, BLACK);
 }
 
 void updateTextEditor(TextEditor *editor) {
-    if (IsKeyPressed(KEY_BACKSPACE) && editor->cursor > 0) {
-        editor->cursor--;
-        editor->text[editor->cursor] = '\0';
-    } else if (IsKeyPressed(KEY_ENTER) && editor->cursor < MAX_TEXT_SIZE - 1) {
-        editor->text[editor->cursor++] = '\n';
-        editor->text[editor->cursor] = '\0';
-    } else if (IsKeyPressed(KEY_LEFT) && editor->cursor > 0) {
-        editor->cursor--;
-    } else if (IsKeyPressed(KEY_RIGHT) && editor->cursor < (int)strlen(editor->text)) {
-        editor->cursor++;
-    } else if (editor->cursor < MAX_TEXT_SIZE - 1) {
+    int lineLength = (int)strlen(GetTextViewLine(editor->view, editor->line));
+    int previousLine = editor->line;
+    int previousColumn = editor->column;
+
+    if (IsKeyPressed(KEY_BACKSPACE)) {
+        if (editor->column > 0) {
+            editor->column--;
+            RemoveTextViewText(editor->view, editor->line, editor->column, 1);
+        } else if (editor->line > 0) {
+            editor->line--;
+            editor->column = (int)strlen(GetTextViewLine(editor->view, editor->line));
+            RemoveTextViewText(editor->view, editor->line, editor->column, 1);
+        }
+    } else if (IsKeyPressed(KEY_ENTER)) {
+        InsertTextViewText(editor->view, editor->line, editor->column, "\n");
+        editor->line++;
+        editor->column = 0;
+    } else if (IsKeyPressed(KEY_LEFT) && editor->column > 0) {
+        editor->column--;
+    } else if (IsKeyPressed(KEY_RIGHT) && editor->column < lineLength) {
+        editor->column++;
+    } else if (IsKeyPressed(KEY_UP) && editor->line > 0) {
+        editor->line--;
+        lineLength = (int)strlen(GetTextViewLine(editor->view, editor->line));
+        if (editor->column > lineLength) editor->column = lineLength;
+    } else if (IsKeyPressed(KEY_DOWN) && editor->line < GetTextViewLineCount(editor->view) - 1) {
+        editor->line++;
+        lineLength = (int)strlen(GetTextViewLine(editor->view, editor->line));
+        if (editor->column > lineLength) editor->column = lineLength;
+    } else {
         int key = GetCharPressed();
         while (key > 0) {
             if ((key >= 32) && (key <= 125)) {
-                editor->text[editor->cursor++] = (char)key;
-                editor->text[editor->cursor] = '\0';
+                char text[2] = { (char)key, '\0' };
+                InsertTextViewText(editor->view, editor->line, editor->column, text);
+                editor->column++;
             }
             key = GetCharPressed();  // Check next character in the queue
         }
     }
+
+    // Scroll with mouse wheel, keep cursor visible when typing
+    float height = GetTextViewHeight(editor->view);
+    float visible = (float)GetScreenHeight() - 20;
+    editor->scroll -= GetMouseWheelMove()*3*FONT_SIZE;
+
+    if (editor->line != previousLine || editor->column != previousColumn) {
+        float cursorY = GetTextViewPosition(editor->view, editor->line, editor->column).y;
+        if (cursorY < editor->scroll) editor->scroll = cursorY;
+        if (cursorY + FONT_SIZE > editor->scroll + visible) editor->scroll = cursorY + FONT_SIZE - visible;
+    }
+
+    if (editor->scroll > height - visible) editor->scroll = height - visible;
+    if (editor->scroll < 0) editor->scroll = 0;
 }
 
 int main(void) {
@@ -65,6 +106,7 @@ int main(void) {
         EndDrawing();
     }
 
+    UnloadTextView(editor.view);
     CloseWindow();
 
     return 0;
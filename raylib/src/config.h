@@ -212,6 +212,12 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Use multiple threads on CPU heavy image processing: images decoding on textures batch loading [LoadTextureBatch()],
+// big shapes rasterization [ImageClearBackground(), ImageDrawRectangleRec(), ImageDrawTriangle()], rotation [ImageRotate*()],
+// mipmaps generation [ImageMipmaps*()], procedural images [GenImageGradientRadial(), GenImageGradientSquare(), GenImagePerlinNoise(), GenImageCellular()],
+// cubemaps generation [GenImageCubemapPanorama(), GenImageCubemapIrradiance(), GenImageCubemapPrefilter()].
+// Requires POSIX threads (pthreads).
+//#define SUPPORT_IMAGE_THREADS           1
 
 
 //------------------------------------------------------------------------------------
@@ -234,11 +240,25 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// On font data loading [LoadFontData()], rasterize glyphs in parallel using multiple threads,
+// useful for big charsets and SDF fonts generation. Requires POSIX threads (pthreads).
+//#define SUPPORT_FONT_DATA_THREADS       1
+
+// On TTF/OTF font loading, extract kerning pairs (GPOS or kern table) for the loaded glyphs,
+// kerning is applied when measuring and drawing text [GetGlyphKerning()]
+#define SUPPORT_FONT_KERNING            1
+
+// On TTF/OTF font loading [LoadFontFromMemory()], save generated font as a binary font file (.rfb)
+// into FONT_CACHE_DIRECTORY, next loads of same font data, size and codepoints use that file
+// NOTE: FONT_CACHE_DIRECTORY is relative to current working directory, an absolute path can be defined
+//#define SUPPORT_FONT_CACHE              1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define FONT_CACHE_DIRECTORY  "fontcache"       // Directory for font cache files, relative to working directory [SUPPORT_FONT_CACHE]
 
 
 //------------------------------------------------------------------------------------
@@ -254,6 +274,9 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// On CPU skinning [UpdateModelAnimation()], split big meshes vertices between multiple threads.
+// Requires POSIX threads (pthreads).
+//#define SUPPORT_MESH_SKINNING_THREADS   1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
@@ -293,6 +293,42 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtextures module
+typedef struct rAtlasData rAtlasData;
+typedef struct rTextureBatchData rTextureBatchData;
+typedef struct rVirtualTextureData rVirtualTextureData;
+typedef struct rGlyphLookup rGlyphLookup;
+typedef struct rTextViewData rTextViewData;
+typedef struct rMeshBVH rMeshBVH;
+typedef struct rModelSkeleton rModelSkeleton;
+
+// TextureAtlas, dynamic texture atlas, images packed on demand into a single texture
+typedef struct TextureAtlas {
+    Texture2D texture;      // Atlas texture (VRAM)
+    rAtlasData *data;       // Pointer to internal data used by the atlas (regions, packer, pixels copy)
+} TextureAtlas;
+
+// VirtualTexture, large texture streamed by pages into a cache texture
+typedef struct VirtualTexture {
+    Texture2D cache;        // Pages cache texture (VRAM)
+    Texture2D indirection;  // Indirection table texture, one texel per page: cache slot (rg) and mip level (b)
+    int width;              // Virtual texture width
+    int height;             // Virtual texture height
+    int pageSize;           // Page size in pixels
+    rVirtualTextureData *data; // Pointer to internal data used by the virtual texture (pages source, residency)
+} VirtualTexture;
+
+// TextureBatch, textures loaded progressively from a list of files
+typedef struct TextureBatch {
+    int count;              // Number of textures in batch
+    int decoded;            // Number of images already decoded (or failed)
+    int processed;          // Number of textures already processed (loaded or failed)
+    char **fileNames;       // Textures file names
+    Texture2D *textures;    // Textures (id is 0 while pending or if loading failed)
+    rTextureBatchData *data; // Pointer to internal data used by the batch (decoded images, decoding threads)
+} TextureBatch;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -320,8 +356,43 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *lookup;   // Glyphs lookup table by codepoint (internal, NULL for fonts filled manually)
 } Font;
 
+// TextLayout, text glyphs positioned once, for fast measuring and drawing
+// NOTE: Layout is only computed again when text or layout parameters change [UpdateTextLayout()]
+typedef struct TextLayout {
+    Font font;              // Font used for layout
+    float fontSize;         // Font size used for layout
+    float spacing;          // Glyphs spacing used for layout
+    float wrapWidth;        // Lines wrapping width, 0 for no wrapping
+    int alignment;          // Lines alignment (TextAlignment)
+    int lineSpacing;        // Line spacing used for layout
+    char *text;             // Text copy, used to detect text changes
+    int glyphCount;         // Number of glyphs to draw (spaces and line breaks not included)
+    int glyphCapacity;      // Number of glyphs allocated
+    int *codepoints;        // Glyphs codepoints
+    int *indices;           // Glyphs indices in font
+    Vector2 *positions;     // Glyphs positions, relative to layout top-left corner
+    Vector2 size;           // Layout size, lines trailing spaces not included
+} TextLayout;
+
+// TextView, big multi-line text, lines wrapping cached and only visible lines drawn
+// NOTE: Lines are only wrapped again when edited or when layout parameters change
+typedef struct TextView {
+    rTextViewData *data;    // Pointer to internal data used by the text view (lines, wrapping cache, rows index)
+} TextView;
+
+// TextBuilder, text string built on a caller buffer (stack, arena...) or on an allocated buffer
+// NOTE: Caller buffer is never reallocated, text is truncated if it does not fit
+typedef struct TextBuilder {
+    char *text;             // Text buffer, always NULL terminated
+    int length;             // Text length in bytes
+    int capacity;           // Text buffer size in bytes
+    bool owned;             // Text buffer allocated by builder, grows on demand
+    bool truncated;         // Text was truncated, did not fit in caller buffer
+} TextBuilder;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -366,6 +437,9 @@ typedef struct Mesh {
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
+
+    // Collision data
+    rMeshBVH *bvh;          // Ray collision acceleration structure (internal, optional) [GenMeshBVH()]
 } Mesh;
 
 // Shader
@@ -415,8 +489,17 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+    rModelSkeleton *skeleton; // Bones inverse bind pose (internal, NULL for models filled manually)
 } Model;
 
+// ModelBatch, models loaded progressively from a list of files
+typedef struct ModelBatch {
+    int count;              // Number of models in batch
+    int processed;          // Number of models already processed (loaded or failed)
+    char **fileNames;       // Models file names
+    Model *models;          // Models (meshCount is 0 while pending or if loading failed)
+} ModelBatch;
+
 // ModelAnimation
 typedef struct ModelAnimation {
     int boneCount;          // Number of bones
@@ -426,6 +509,14 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// ModelAnimationLayer, animation sampled for blending
+typedef struct ModelAnimationLayer {
+    ModelAnimation anim;    // Animation data
+    float frame;            // Animation frame, fractional frames are interpolated (looping)
+    float weight;           // Layer weight (0.0f..1.0f), blended over previous layers
+    float *boneMask;        // Layer weight multiplier by model bone (0.0f..1.0f), NULL for all bones
+} ModelAnimationLayer;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -888,16 +979,25 @@ typedef enum {
     CUBEMAP_LAYOUT_LINE_VERTICAL,           // Layout is defined by a vertical line with faces
     CUBEMAP_LAYOUT_LINE_HORIZONTAL,         // Layout is defined by a horizontal line with faces
     CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR,     // Layout is defined by a 3x4 cross with cubemap faces
-    CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE     // Layout is defined by a 4x3 cross with cubemap faces
+    CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE,    // Layout is defined by a 4x3 cross with cubemap faces
+    CUBEMAP_LAYOUT_PANORAMA                // Layout is defined by an equirectangular panorama image (2:1)
 } CubemapLayout;
 
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, drawn with built-in SDF shader [LoadFontSDF()]
+    FONT_MSDF                       // Multi-channel SDF font generation, sharp corners, drawn with built-in SDF shader [LoadFontSDF()]
 } FontType;
 
+// Text alignment, used by text layout
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,            // Lines aligned to the left
+    TEXT_ALIGN_CENTER,              // Lines centered
+    TEXT_ALIGN_RIGHT                // Lines aligned to the right
+} TextAlignment;
+
 // Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
@@ -1330,6 +1430,8 @@ RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+RLAPI Image LoadImageRegion(const char *fileName, Rectangle region, int scale);                          // Load image region from file, scaled down by 1, 2, 4 or 8 (zero size region loads full image)
+RLAPI Image LoadImageRegionFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, Rectangle region, int scale); // Load image region from memory buffer, scaled down by 1, 2, 4 or 8 (QOI/PNG streamed, other formats decoded in full up to a size limit)
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageValid(Image image);                                                                    // Check if an image is valid (data and parameters)
@@ -1337,6 +1439,7 @@ RLAPI void UnloadImage(Image image);
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI void SetImageExportCompression(int level);                                                         // Set PNG compression level for image export [0..9], 0 stores data uncompressed (only with SUPPORT_COMPRESSION_API)
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1348,6 +1451,9 @@ RLAPI Image GenImageWhiteNoise(int width, int height, float factor);
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
+RLAPI Image GenImageCubemapPanorama(Image panorama, int size);                                            // Generate cubemap image (vertical line layout) from equirectangular panorama
+RLAPI Image GenImageCubemapIrradiance(Image cubemap, int size);                                           // Generate diffuse irradiance cubemap image from cubemap image (vertical line layout)
+RLAPI Image GenImageCubemapPrefilter(Image cubemap, int size, int mipmaps);                               // Generate specular prefiltered cubemap image (GGX), roughness increases with mipmap level
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1368,6 +1474,7 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, bool sRGB, float alphaCoverage);                                 // Compute all mipmap levels, filtering in linear space (sRGB) and preserving alpha test coverage (0.0f to disable)
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1425,6 +1532,31 @@ RLAPI void UnloadRenderTexture(RenderTexture2D target);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Texture batch loading functions
+// NOTE: Useful for loading screens, UpdateTextureBatch() is expected to be called once per frame
+RLAPI TextureBatch LoadTextureBatch(const char **fileNames, int count);                                  // Load textures batch from files list, textures are loaded progressively
+RLAPI void UnloadTextureBatch(TextureBatch batch);                                                       // Unload textures batch (loaded textures are also unloaded)
+RLAPI bool UpdateTextureBatch(TextureBatch *batch, float timeBudget);                                    // Load pending textures within a time budget (seconds), returns true when batch is completed
+RLAPI float GetTextureBatchProgress(TextureBatch batch);                                                 // Get textures batch loading progress [0.0f..1.0f]
+
+// Texture atlas functions
+// NOTE: Regions are identified by id, rectangles can change on repacking (use GetTextureAtlasRec() every frame)
+RLAPI TextureAtlas LoadTextureAtlas(int width, int height, int format);                                  // Load dynamic texture atlas (VRAM), images are packed on demand
+RLAPI bool IsTextureAtlasValid(TextureAtlas atlas);                                                      // Check if a texture atlas is valid (loaded in GPU)
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas from GPU memory (VRAM)
+RLAPI int AddTextureAtlasImage(TextureAtlas atlas, Image image);                                         // Add image to texture atlas, returns region id (-1 on failure), LRU regions evicted if required
+RLAPI void RemoveTextureAtlasImage(TextureAtlas atlas, int id);                                          // Remove image region from texture atlas
+RLAPI Rectangle GetTextureAtlasRec(TextureAtlas atlas, int id);                                          // Get region rectangle in atlas texture (marked as used), empty if region was evicted
+RLAPI void PackTextureAtlas(TextureAtlas atlas);                                                         // Repack texture atlas regions, recovers space from removed regions
+
+// Virtual texture functions
+// NOTE: Feedback image is a pass rendering requested pages as R8G8B8A8 pixels, check rtextures.c for encoding
+RLAPI VirtualTexture LoadVirtualTexture(Image image, int pageSize, int budget);                           // Load virtual texture from image, pages streamed into a cache texture within budget (VRAM bytes)
+RLAPI bool IsVirtualTextureValid(VirtualTexture texture);                                                 // Check if a virtual texture is valid (loaded in GPU)
+RLAPI void UnloadVirtualTexture(VirtualTexture texture);                                                  // Unload virtual texture from GPU memory (VRAM) and pages source from RAM
+RLAPI void UpdateVirtualTexture(VirtualTexture texture, Image feedback);                                  // Update virtual texture pages residency from feedback pass image
+RLAPI int GetVirtualTextureResidentPages(VirtualTexture texture);                                         // Get virtual texture number of pages resident in cache
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -1467,12 +1599,18 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type); // Load SDF font (FONT_SDF, FONT_MSDF), single atlas drawn at any size with built-in SDF shader
+RLAPI Font LoadFontBinary(const char *fileName);                                            // Load font from binary font file (.rfb), no glyphs rasterization or atlas packing
+RLAPI Font LoadFontBinaryFromMemory(const unsigned char *fileData, int dataSize);           // Load font from binary font data in memory, i.e. embedded or memory-mapped file
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);              // Load font with glyphs rasterized on demand (TTF/OTF), cached into an atlas of provided size (0 for default)
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load font with glyphs rasterized on demand from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
+RLAPI bool ExportFontBinary(Font font, const char *fileName);                               // Export font as binary font file (.rfb): glyphs, atlas pixels and kerning, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
@@ -1489,6 +1627,26 @@ RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float s
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                   // Get kerning adjustment between two codepoints (pixels for font base size), 0 if no kerning
+
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth, int alignment); // Load text layout, glyphs positioned with lines wrapping (wrapWidth > 0) and alignment
+RLAPI void UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth, int alignment); // Update text layout, only computed again if text or parameters changed
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout
+
+// Text view functions (big multi-line texts)
+RLAPI TextView LoadTextView(Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text view, text split in lines, wrapped if wrapWidth > 0
+RLAPI void UnloadTextView(TextView view);                                                   // Unload text view data
+RLAPI void SetTextViewLayout(TextView view, Font font, float fontSize, float spacing, float wrapWidth); // Set text view layout parameters, lines only wrapped again if changed
+RLAPI void InsertTextViewText(TextView view, int line, int column, const char *text);      // Insert text at line and column (bytes), line breaks allowed
+RLAPI void RemoveTextViewText(TextView view, int line, int column, int length);            // Remove text bytes at line and column, line breaks count as one byte
+RLAPI int GetTextViewLineCount(TextView view);                                              // Get text view lines count
+RLAPI const char *GetTextViewLine(TextView view, int line);                                 // Get text view line text (no line break)
+RLAPI float GetTextViewHeight(TextView view);                                               // Get text view content height, all wrapped lines
+RLAPI int GetTextViewLineAt(TextView view, float offsetY);                                  // Get text view line at vertical offset from content top
+RLAPI Vector2 GetTextViewPosition(TextView view, int line, int column);                     // Get text view position of line and column (bytes), relative to content top-left
+RLAPI void DrawTextView(TextView view, Rectangle bounds, float scroll, Color tint);         // Draw text view lines visible in bounds, scroll is vertical offset from content top
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                                    // Load UTF-8 text encoded from codepoints array
@@ -1503,6 +1661,8 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);
 
 // Text strings management functions (no UTF-8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
+// WARNING: Other returned strings use internal static buffers, valid until next call of same function,
+// buffers are thread local (C11, GCC, Clang, MSVC), with other compilers they are shared between threads
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
@@ -1523,6 +1683,14 @@ RLAPI char *TextToCamel(const char *text);
 RLAPI int TextToInteger(const char *text);                                                  // Get integer value from text
 RLAPI float TextToFloat(const char *text);                                                  // Get float value from text
 
+// Text builder functions (no memory allocated for caller buffers)
+RLAPI TextBuilder LoadTextBuilder(char *buffer, int size);                                  // Load text builder on caller buffer, allocated (and growing) if buffer is NULL
+RLAPI void UnloadTextBuilder(TextBuilder builder);                                          // Unload text builder, caller buffer is not freed
+RLAPI void TextBuilderReset(TextBuilder *builder);                                          // Reset text builder to empty text
+RLAPI void TextBuilderAppend(TextBuilder *builder, const char *text);                       // Append text to builder
+RLAPI void TextBuilderAppendFormat(TextBuilder *builder, const char *text, ...);            // Append formatted text to builder (sprintf() style)
+RLAPI void TextBuilderJoin(TextBuilder *builder, char **textList, int count, const char *delimiter); // Append text strings joined with delimiter to builder
+
 //------------------------------------------------------------------------------------
 // Basic 3d Shapes Drawing Functions (Module: models)
 //------------------------------------------------------------------------------------
@@ -1561,6 +1729,13 @@ RLAPI bool IsModelValid(Model model);
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
 
+// Model batch loading functions
+// NOTE: Useful for loading screens, UpdateModelBatch() is expected to be called once per frame
+RLAPI ModelBatch LoadModelBatch(const char **fileNames, int count);                         // Load models batch from files list, models are loaded progressively
+RLAPI void UnloadModelBatch(ModelBatch batch);                                              // Unload models batch (loaded models are also unloaded)
+RLAPI bool UpdateModelBatch(ModelBatch *batch, float timeBudget);                           // Load pending models within a time budget (seconds), returns true when batch is completed
+RLAPI float GetModelBatchProgress(ModelBatch batch);                                        // Get models batch loading progress [0.0f..1.0f]
+
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
@@ -1581,6 +1756,7 @@ RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshBVH(Mesh *mesh);                                                          // Generate mesh bounding volume hierarchy, speeds up ray collision
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1609,6 +1785,8 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
+RLAPI void UpdateModelAnimationLayers(Model model, const ModelAnimationLayer *layers, int layerCount); // Update model animation mesh bone matrices, blending layers at fractional frames
+RLAPI void UpdateModelSkinning(Model model, bool updateNormals);                            // Update model animated vertex data from current bone matrices (CPU skinning)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -1620,6 +1798,8 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);            // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                            // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);               // Get collision info between ray and mesh
+RLAPI void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions); // Get collision info between multiple rays and mesh
+RLAPI RayCollision GetRayCollisionModel(Ray ray, Model model);                              // Get collision info between ray and model (closest mesh hit)
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);    // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4); // Get collision info between ray and quad
 
@@ -491,6 +491,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RTEXT)
+extern void UnloadTextResources(void);  // [Module: text] Unloads text module GPU resources (built-in SDF shader)
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -742,6 +745,9 @@ void CloseWindow(void)
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
+#if defined(SUPPORT_MODULE_RTEXT)
+    UnloadTextResources();      // WARNING: Module required: rtext
+#endif
 
     rlglClose();                // De-init rlgl
 
@@ -718,6 +718,7 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -2709,6 +2710,16 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
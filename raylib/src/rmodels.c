@@ -18,6 +18,10 @@
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_MESH_SKINNING_THREADS
+*           On CPU skinning [UpdateModelAnimation(), UpdateModelSkinning()], split big meshes vertices
+*           between multiple threads. Requires POSIX threads (pthreads).
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -57,6 +61,7 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -115,6 +120,10 @@
     #endif
 #endif
 
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join() [Used in UpdateModelSkinning()]
+#endif
+
 #if defined(_WIN32)
     #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
     #define CHDIR _chdir
@@ -132,11 +141,61 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      64    // Maximum mesh BVH depth, also traversal stack size [GenMeshBVH()]
+#endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  8    // Maximum triangles per mesh BVH leaf, if SAH does not split it before
+#endif
+#define MESH_BVH_SAH_BINS           16    // Mesh BVH build binning, split candidates per axis
+#ifndef MESH_SKINNING_MAX_THREADS
+    #define MESH_SKINNING_MAX_THREADS        8    // Maximum number of threads skinning a mesh [SUPPORT_MESH_SKINNING_THREADS]
+#endif
+#ifndef MESH_SKINNING_THREAD_MIN_VERTICES
+    #define MESH_SKINNING_THREAD_MIN_VERTICES 4096 // Minimum number of vertices per thread [SUPPORT_MESH_SKINNING_THREADS]
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh BVH node, 32 bytes
+// NOTE: Inner nodes store left child index (right child is next one), leaves store first triangle index
+typedef struct MeshBVHNode {
+    Vector3 min;                // Node bounds minimum
+    int first;                  // Left child index (inner node) or first triangle index (leaf)
+    Vector3 max;                // Node bounds maximum
+    int count;                  // Triangles count (leaf), 0 for inner nodes
+} MeshBVHNode;
+
+// Mesh bounding volume hierarchy for ray collision
+// NOTE: Triangles are copied in leaves order, as first vertex and two edges (9 floats),
+// so traversal does not touch mesh vertex/index data
+struct rMeshBVH {
+    int nodeCount;              // Number of nodes, root is nodes[0]
+    MeshBVHNode *nodes;         // Nodes array, flattened depth-first
+    int triangleCount;          // Number of triangles
+    float *triangles;           // Triangles data: v0, v1 - v0, v2 - v0
+};
+
+// Mesh skinning batch, range of vertices skinned with prepared bones transforms
+typedef struct MeshSkinningBatch {
+    const float *vertices;      // Base vertex positions (XYZ)
+    const float *normals;       // Base vertex normals (XYZ), NULL to skip normals
+    const unsigned char *boneIds; // Vertex bone ids, 4 per vertex
+    const float *boneWeights;   // Vertex bone weights, 4 per vertex
+    const float *bones;         // Bones transforms, 3x4 row-major (12 floats per bone), zero transform at index 256
+    const float *normalBones;   // Bones normals transforms (inverse transpose), 3x4 row-major, no translation
+    float *animVertices;        // Skinned vertex positions output
+    float *animNormals;         // Skinned vertex normals output
+    int first;                  // First vertex in batch
+    int count;                  // Vertices count in batch
+} MeshSkinningBatch;
+
+// Model skeleton runtime data, computed once from model bind pose
+struct rModelSkeleton {
+    int boneCount;              // Number of bones
+    Transform *invBindPose;     // Bones inverse bind pose (rotation, translation and scale inverted)
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -167,6 +226,15 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void UnloadMeshBVH(rMeshBVH *bvh);       // Unload mesh BVH data
+static void *UpdateMeshSkinning(void *batch);   // Skin a range of mesh vertices, thread entry point [SUPPORT_MESH_SKINNING_THREADS]
+static rModelSkeleton *LoadModelSkeleton(const Transform *bindPose, int boneCount); // Load model skeleton runtime data (inverse bind pose)
+static void UnloadModelSkeleton(rModelSkeleton *skeleton); // Unload model skeleton runtime data
+static Transform GetBindPoseInverse(Transform bindPose); // Get bone bind pose inverse transform
+static bool GetRayTriangleDistance(Vector3 origin, Vector3 direction, Vector3 v0, Vector3 edge1, Vector3 edge2, float *distance); // Get ray distance to triangle (edges from v0)
+static bool GetRayBoxDistance(Vector3 origin, Vector3 invDirection, Vector3 min, Vector3 max, float maxDistance, float *distance); // Get ray entry distance to box (slabs test)
+static RayCollision GetRayCollisionMeshWorld(Ray ray, Mesh mesh, Matrix transform); // Get collision info between ray and mesh, transformed into world space
+static int GetRayCollisionMeshLocal(Vector3 origin, Vector3 direction, Mesh mesh, float *distance, Vector3 *normal); // Get closest triangle hit by ray in mesh space, -1 if none
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1110,6 +1178,9 @@ Model LoadModel(const char *fileName)
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
 
+    // Precompute inverse bind pose for animations
+    if ((model.boneCount > 0) && (model.bindPose != NULL)) model.skeleton = LoadModelSkeleton(model.bindPose, model.boneCount);
+
     if ((model.meshCount != 0) && (model.meshes != NULL))
     {
         // Upload vertex data to GPU (static meshes)
@@ -1209,6 +1280,7 @@ void UnloadModel(Model model)
     // Unload animation data
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
+    UnloadModelSkeleton(model.skeleton);
 
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
@@ -1248,6 +1320,67 @@ BoundingBox GetModelBoundingBox(Model model)
     return bounds;
 }
 
+// Load models batch from a list of files, models are loaded progressively with UpdateModelBatch()
+// NOTE: Models are accessed by file index: batch.models[i], meshCount is 0 while pending or if loading failed
+ModelBatch LoadModelBatch(const char **fileNames, int count)
+{
+    ModelBatch batch = { 0 };
+
+    if ((fileNames == NULL) || (count <= 0)) return batch;
+
+    batch.count = count;
+    batch.fileNames = (char **)RL_CALLOC(count, sizeof(char *));
+    batch.models = (Model *)RL_CALLOC(count, sizeof(Model));
+
+    for (int i = 0; i < count; i++)
+    {
+        int length = (int)strlen(fileNames[i]);
+        batch.fileNames[i] = (char *)RL_MALLOC(length + 1);
+        memcpy(batch.fileNames[i], fileNames[i], length + 1);
+    }
+
+    return batch;
+}
+
+// Unload models batch, loaded models are also unloaded
+void UnloadModelBatch(ModelBatch batch)
+{
+    for (int i = 0; i < batch.count; i++)
+    {
+        if (i < batch.processed) UnloadModel(batch.models[i]);
+        RL_FREE(batch.fileNames[i]);
+    }
+
+    RL_FREE(batch.fileNames);
+    RL_FREE(batch.models);
+}
+
+// Load pending models of the batch within a time budget (in seconds), returns true when batch is completed
+// NOTE: Time budget is checked before every model load, at least one model is loaded per call.
+// Models are loaded on calling thread, file formats loaders upload meshes and materials textures while parsing
+bool UpdateModelBatch(ModelBatch *batch, float timeBudget)
+{
+    double startTime = GetTime();
+    int loadCount = 0;
+
+    while (batch->processed < batch->count)
+    {
+        if ((loadCount > 0) && ((GetTime() - startTime) >= timeBudget)) break;
+
+        batch->models[batch->processed] = LoadModel(batch->fileNames[batch->processed]);
+        batch->processed++;
+        loadCount++;
+    }
+
+    return (batch->processed == batch->count);
+}
+
+// Get models batch loading progress [0.0f..1.0f]
+float GetModelBatchProgress(ModelBatch batch)
+{
+    return (batch.count > 0)? (float)batch.processed/(float)batch.count : 1.0f;
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void UploadMesh(Mesh *mesh, bool dynamic)
 {
@@ -1933,6 +2066,8 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
     RL_FREE(mesh.boneMatrices);
+
+    UnloadMeshBVH(mesh.bvh);
 }
 
 // Export mesh data to file
@@ -2268,134 +2403,203 @@ void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+        frame = frame%anim.frameCount;
+        if (frame < 0) frame += anim.frameCount;
+
+        ModelAnimationLayer layer = { anim, (float)frame, 1.0f, NULL };
+
+        UpdateModelAnimationLayers(model, &layer, 1);
+    }
+}
 
-        // Get first mesh which have bones
-        int firstMeshWithBones = -1;
+// Update model animated bones transform matrices, blending animation layers
+// NOTE 1: Layers are applied in order, every layer blends over previous layers result (bind pose for first one),
+// bones not animated by any layer are kept in bind pose
+// NOTE 2: Fractional frames are interpolated with next frame (looping), translation/scale lerp and rotation slerp
+// NOTE 3: Updated data is not uploaded to GPU but kept at model.meshes[i].boneMatrices[boneId]
+void UpdateModelAnimationLayers(Model model, const ModelAnimationLayer *layers, int layerCount)
+{
+    // Get first mesh which have bones
+    int firstMeshWithBones = -1;
 
-        for (int i = 0; i < model.meshCount; i++)
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices != NULL)
         {
-            if (model.meshes[i].boneMatrices)
-            {
-                if (firstMeshWithBones == -1)
-                {
-                    firstMeshWithBones = i;
-                    break;
-                }
-            }
+            firstMeshWithBones = i;
+            break;
         }
+    }
+
+    if ((firstMeshWithBones == -1) || (model.bindPose == NULL)) return;
+
+    Matrix *boneMatrices = model.meshes[firstMeshWithBones].boneMatrices;
+    int boneCount = (model.meshes[firstMeshWithBones].boneCount < model.boneCount)? model.meshes[firstMeshWithBones].boneCount : model.boneCount;
+
+    // Inverse bind pose is computed once on model loading, models filled manually compute it per bone
+    // NOTE: Bones are blended one by one (all layers per bone), pose is kept on stack and no
+    // shared blending buffer is required, models sharing skeleton can be updated from multiple threads
+    const rModelSkeleton *skeleton = model.skeleton;
 
-        // Update all bones and boneMatrices of first mesh with bones.
-        for (int boneId = 0; boneId < anim.boneCount; boneId++)
+    for (int boneId = 0; boneId < boneCount; boneId++)
+    {
+        Transform pose = model.bindPose[boneId];
+
+        for (int i = 0; i < layerCount; i++)
         {
-            Vector3 inTranslation = model.bindPose[boneId].translation;
-            Quaternion inRotation = model.bindPose[boneId].rotation;
-            Vector3 inScale = model.bindPose[boneId].scale;
+            ModelAnimation anim = layers[i].anim;
+            if ((anim.frameCount <= 0) || (anim.framePoses == NULL) || (layers[i].weight <= 0.0f) || (boneId >= anim.boneCount)) continue;
 
-            Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-            Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-            Vector3 outScale = anim.framePoses[frame][boneId].scale;
+            float weight = layers[i].weight;
+            if (layers[i].boneMask != NULL) weight *= layers[i].boneMask[boneId];
+            if (weight <= 0.0f) continue;
 
-            Quaternion invRotation = QuaternionInvert(inRotation);
-            Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), invRotation);
-            Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
+            // Get frames to interpolate, looping animation
+            float frame = fmodf(layers[i].frame, (float)anim.frameCount);
+            if (frame < 0.0f) frame += anim.frameCount;
 
-            Vector3 boneTranslation = Vector3Add(Vector3RotateByQuaternion(
-                Vector3Multiply(outScale, invTranslation), outRotation), outTranslation);
-            Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-            Vector3 boneScale = Vector3Multiply(outScale, invScale);
+            int currentFrame = (int)frame;
+            if (currentFrame >= anim.frameCount) currentFrame = anim.frameCount - 1;
+            int nextFrame = (currentFrame + 1)%anim.frameCount;
+            float amount = frame - currentFrame;
 
-            Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                QuaternionToMatrix(boneRotation),
-                MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                MatrixScale(boneScale.x, boneScale.y, boneScale.z));
+            Transform sample = anim.framePoses[currentFrame][boneId];
 
-            model.meshes[firstMeshWithBones].boneMatrices[boneId] = boneMatrix;
-        }
+            if (amount > 0.0f)
+            {
+                Transform next = anim.framePoses[nextFrame][boneId];
+                sample.translation = Vector3Lerp(sample.translation, next.translation, amount);
+                sample.rotation = QuaternionSlerp(sample.rotation, next.rotation, amount);
+                sample.scale = Vector3Lerp(sample.scale, next.scale, amount);
+            }
 
-        // Update remaining meshes with bones
-        // NOTE: Using deep copy because shallow copy results in double free with 'UnloadModel()'
-        if (firstMeshWithBones != -1)
-        {
-            for (int i = firstMeshWithBones + 1; i < model.meshCount; i++)
+            if (weight >= 1.0f) pose = sample;
+            else
             {
-                if (model.meshes[i].boneMatrices)
-                {
-                    memcpy(model.meshes[i].boneMatrices,
-                        model.meshes[firstMeshWithBones].boneMatrices,
-                        model.meshes[i].boneCount*sizeof(model.meshes[i].boneMatrices[0]));
-                }
+                // NOTE: Layers rotations are blended with normalized lerp (shortest path), cheaper than slerp
+                Quaternion rotation = pose.rotation;
+                if ((rotation.x*sample.rotation.x + rotation.y*sample.rotation.y + rotation.z*sample.rotation.z + rotation.w*sample.rotation.w) < 0.0f) sample.rotation = QuaternionScale(sample.rotation, -1.0f);
+
+                pose.translation = Vector3Lerp(pose.translation, sample.translation, weight);
+                pose.rotation = QuaternionNlerp(rotation, sample.rotation, weight);
+                pose.scale = Vector3Lerp(pose.scale, sample.scale, weight);
             }
         }
+
+        // Compute bone matrix from blended pose and inverse bind pose
+        Transform invBind = ((skeleton != NULL) && (boneId < skeleton->boneCount))? skeleton->invBindPose[boneId] : GetBindPoseInverse(model.bindPose[boneId]);
+
+        Vector3 boneTranslation = Vector3Add(Vector3RotateByQuaternion(
+            Vector3Multiply(pose.scale, invBind.translation), pose.rotation), pose.translation);
+        Quaternion boneRotation = QuaternionMultiply(pose.rotation, invBind.rotation);
+        Vector3 boneScale = Vector3Multiply(pose.scale, invBind.scale);
+
+        // Same as MatrixMultiply(MatrixMultiply(rotation, translation), scale), built directly
+        Matrix rotation = QuaternionToMatrix(boneRotation);
+
+        boneMatrices[boneId] = (Matrix){
+            rotation.m0*boneScale.x, rotation.m4*boneScale.x, rotation.m8*boneScale.x, boneTranslation.x*boneScale.x,
+            rotation.m1*boneScale.y, rotation.m5*boneScale.y, rotation.m9*boneScale.y, boneTranslation.y*boneScale.y,
+            rotation.m2*boneScale.z, rotation.m6*boneScale.z, rotation.m10*boneScale.z, boneTranslation.z*boneScale.z,
+            0.0f, 0.0f, 0.0f, 1.0f };
+    }
+
+    // Update remaining meshes with bones
+    // NOTE: Using deep copy because shallow copy results in double free with 'UnloadModel()'
+    for (int i = firstMeshWithBones + 1; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices)
+        {
+            memcpy(model.meshes[i].boneMatrices,
+                model.meshes[firstMeshWithBones].boneMatrices,
+                model.meshes[i].boneCount*sizeof(model.meshes[i].boneMatrices[0]));
+        }
     }
 }
 
-// at least 2x speed up vs the old method
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    UpdateModelAnimationBones(model,anim,frame);
+    UpdateModelAnimationBones(model, anim, frame);
+    UpdateModelSkinning(model, true);
+}
+
+// Update model animated vertex data from current mesh bone matrices (CPU skinning)
+// NOTE 1: Bone matrices must be updated before [UpdateModelAnimationBones()], normals skinning can be skipped
+// NOTE 2: Bones transforms are prepared once per bone, normals use bone matrix inverse transpose,
+// singular bone matrices (i.e. bones scaled to zero) use bone matrix for normals
+void UpdateModelSkinning(Model model, bool updateNormals)
+{
+    // NOTE: Vertex bone ids are limited to 256 bones (unsigned char), one more zero transform for unused influences
+    float bones[257*12] = { 0 };
+    float normalBones[257*12] = { 0 };
 
     for (int m = 0; m < model.meshCount; m++)
     {
         Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false; // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
 
         // Skip if missing bone data, causes segfault without on some models
-        if ((mesh.boneWeights == NULL) || (mesh.boneIds == NULL)) continue;
+        if ((mesh.boneWeights == NULL) || (mesh.boneIds == NULL) || (mesh.boneMatrices == NULL) || (mesh.animVertices == NULL)) continue;
+
+        bool normals = updateNormals && (mesh.normals != NULL) && (mesh.animNormals != NULL);
+        int boneCount = (mesh.boneCount < 256)? mesh.boneCount : 256;
 
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        for (int i = 0; i < boneCount; i++)
         {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
+            Matrix mat = mesh.boneMatrices[i];
+            float bone[12] = { mat.m0, mat.m4, mat.m8, mat.m12, mat.m1, mat.m5, mat.m9, mat.m13, mat.m2, mat.m6, mat.m10, mat.m14 };
+            memcpy(bones + i*12, bone, sizeof(bone));
 
-            // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
+            if (normals)
             {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y*boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z*boneWeight;
-                updated = true;
-
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if ((mesh.normals != NULL) && (mesh.animNormals != NULL ))
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal, MatrixTranspose(MatrixInvert(model.meshes[m].boneMatrices[boneId])));
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
+                Matrix normalMat = (MatrixDeterminant(mat) != 0.0f)? MatrixTranspose(MatrixInvert(mat)) : mat;
+                float normalBone[12] = { normalMat.m0, normalMat.m4, normalMat.m8, 0.0f, normalMat.m1, normalMat.m5, normalMat.m9, 0.0f, normalMat.m2, normalMat.m6, normalMat.m10, 0.0f };
+                memcpy(normalBones + i*12, normalBone, sizeof(normalBone));
             }
         }
 
-        if (updated)
+        MeshSkinningBatch batch = { mesh.vertices, normals? mesh.normals : NULL, mesh.boneIds, mesh.boneWeights,
+            bones, normalBones, mesh.animVertices, mesh.animNormals, 0, mesh.vertexCount };
+
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+        int threadCount = mesh.vertexCount/MESH_SKINNING_THREAD_MIN_VERTICES;
+        if (threadCount > MESH_SKINNING_MAX_THREADS) threadCount = MESH_SKINNING_MAX_THREADS;
+
+        if (threadCount > 1)
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            if (mesh.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0); // Update vertex normals
+            MeshSkinningBatch batches[MESH_SKINNING_MAX_THREADS] = { 0 };
+            pthread_t threads[MESH_SKINNING_MAX_THREADS] = { 0 };
+            bool threadRunning[MESH_SKINNING_MAX_THREADS] = { 0 };
+
+            // Vertices are split in contiguous ranges, every vertex is written by a single batch
+            // NOTE: Batch 0 is processed by calling thread, batches failing to start too
+            for (int t = 0; t < threadCount; t++)
+            {
+                batches[t] = batch;
+                batches[t].first = (int)((long long)mesh.vertexCount*t/threadCount);
+                batches[t].count = (int)((long long)mesh.vertexCount*(t + 1)/threadCount) - batches[t].first;
+
+                if (t > 0) threadRunning[t] = (pthread_create(&threads[t], NULL, UpdateMeshSkinning, &batches[t]) == 0);
+            }
+
+            for (int t = 0; t < threadCount; t++)
+            {
+                if (!threadRunning[t]) UpdateMeshSkinning(&batches[t]);
+            }
+
+            for (int t = 1; t < threadCount; t++)
+            {
+                if (threadRunning[t]) pthread_join(threads[t], NULL);
+            }
         }
+        else UpdateMeshSkinning(&batch);
+#else
+        UpdateMeshSkinning(&batch);
+#endif
+
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+        if (normals) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0); // Update vertex normals
     }
 }
 
@@ -3719,6 +3923,242 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Generate mesh BVH for ray collision
+// NOTE 1: Built with binned surface area heuristic (SAH), from mesh vertex data on CPU (not animated)
+// NOTE 2: BVH must be generated again if mesh vertices or indices are modified
+void GenMeshBVH(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Vertex data not available, BVH could not be generated");
+        return;
+    }
+
+    UnloadMeshBVH(mesh->bvh);
+    mesh->bvh = NULL;
+
+    int triangleCount = mesh->triangleCount;
+    Vector3 *vertices = (Vector3 *)mesh->vertices;
+
+    // Triangles bounds and centroids, referenced by index and partitioned in-place while building
+    int *indices = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    BoundingBox *bounds = (BoundingBox *)RL_MALLOC(triangleCount*sizeof(BoundingBox));
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a = vertices[(mesh->indices != NULL)? mesh->indices[i*3 + 0] : i*3 + 0];
+        Vector3 b = vertices[(mesh->indices != NULL)? mesh->indices[i*3 + 1] : i*3 + 1];
+        Vector3 c = vertices[(mesh->indices != NULL)? mesh->indices[i*3 + 2] : i*3 + 2];
+
+        indices[i] = i;
+        bounds[i].min = Vector3Min(Vector3Min(a, b), c);
+        bounds[i].max = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(bounds[i].min, bounds[i].max), 0.5f);
+    }
+
+    // NOTE: Every split creates two nodes and leaves are never empty, so nodes count is limited by 2*triangleCount - 1
+    MeshBVHNode *nodes = (MeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBVHNode));
+    int nodeCount = 1;
+
+    struct { int node, first, count, depth; } stack[MESH_BVH_MAX_DEPTH + 1];
+    int stackSize = 1;
+    stack[0].node = 0;
+    stack[0].first = 0;
+    stack[0].count = triangleCount;
+    stack[0].depth = 0;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        int nodeIndex = stack[stackSize].node;
+        int first = stack[stackSize].first;
+        int count = stack[stackSize].count;
+        int depth = stack[stackSize].depth;
+
+        // Compute node bounds and triangles centroids bounds
+        BoundingBox box = bounds[indices[first]];
+        Vector3 centroidMin = centroids[indices[first]];
+        Vector3 centroidMax = centroidMin;
+
+        for (int i = first + 1; i < first + count; i++)
+        {
+            box.min = Vector3Min(box.min, bounds[indices[i]].min);
+            box.max = Vector3Max(box.max, bounds[indices[i]].max);
+            centroidMin = Vector3Min(centroidMin, centroids[indices[i]]);
+            centroidMax = Vector3Max(centroidMax, centroids[indices[i]]);
+        }
+
+        nodes[nodeIndex].min = box.min;
+        nodes[nodeIndex].max = box.max;
+        nodes[nodeIndex].first = first;
+        nodes[nodeIndex].count = count;
+
+        if ((count <= 1) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
+
+        // Find best split with surface area heuristic, triangles binned by centroid on every axis
+        // NOTE: Cost is measured as triangles tests weighted by surface area, one node traversal costs as one triangle
+        float bestCost = 0.0f;
+        int bestAxis = -1;
+        int bestSplit = 0;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float axisMin = (axis == 0)? centroidMin.x : (axis == 1)? centroidMin.y : centroidMin.z;
+            float axisMax = (axis == 0)? centroidMax.x : (axis == 1)? centroidMax.y : centroidMax.z;
+            if (axisMax <= axisMin) continue;
+
+            BoundingBox binBounds[MESH_BVH_SAH_BINS] = { 0 };
+            int binCounts[MESH_BVH_SAH_BINS] = { 0 };
+            float binScale = MESH_BVH_SAH_BINS/(axisMax - axisMin);
+
+            for (int i = first; i < first + count; i++)
+            {
+                float centroid = (axis == 0)? centroids[indices[i]].x : (axis == 1)? centroids[indices[i]].y : centroids[indices[i]].z;
+                int bin = (int)((centroid - axisMin)*binScale);
+                if (bin > MESH_BVH_SAH_BINS - 1) bin = MESH_BVH_SAH_BINS - 1;
+
+                if (binCounts[bin] == 0) binBounds[bin] = bounds[indices[i]];
+                else
+                {
+                    binBounds[bin].min = Vector3Min(binBounds[bin].min, bounds[indices[i]].min);
+                    binBounds[bin].max = Vector3Max(binBounds[bin].max, bounds[indices[i]].max);
+                }
+                binCounts[bin]++;
+            }
+
+            // Sweep bins from both sides, accumulating area*count for left and right of every split plane
+            float leftCost[MESH_BVH_SAH_BINS - 1] = { 0 };
+            BoundingBox sweep = { 0 };
+            int sweepCount = 0;
+
+            for (int i = 0; i < MESH_BVH_SAH_BINS - 1; i++)
+            {
+                if (binCounts[i] > 0)
+                {
+                    if (sweepCount == 0) sweep = binBounds[i];
+                    else
+                    {
+                        sweep.min = Vector3Min(sweep.min, binBounds[i].min);
+                        sweep.max = Vector3Max(sweep.max, binBounds[i].max);
+                    }
+                    sweepCount += binCounts[i];
+                }
+
+                Vector3 size = Vector3Subtract(sweep.max, sweep.min);
+                leftCost[i] = (sweepCount > 0)? sweepCount*(size.x*size.y + size.y*size.z + size.z*size.x) : 0.0f;
+            }
+
+            sweepCount = 0;
+
+            for (int i = MESH_BVH_SAH_BINS - 1; i > 0; i--)
+            {
+                if (binCounts[i] > 0)
+                {
+                    if (sweepCount == 0) sweep = binBounds[i];
+                    else
+                    {
+                        sweep.min = Vector3Min(sweep.min, binBounds[i].min);
+                        sweep.max = Vector3Max(sweep.max, binBounds[i].max);
+                    }
+                    sweepCount += binCounts[i];
+                }
+
+                if ((sweepCount == 0) || (sweepCount == count)) continue;
+
+                Vector3 size = Vector3Subtract(sweep.max, sweep.min);
+                float cost = leftCost[i - 1] + sweepCount*(size.x*size.y + size.y*size.z + size.z*size.x);
+
+                if ((bestAxis == -1) || (cost < bestCost))
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i;
+                }
+            }
+        }
+
+        // All centroids in the same position, triangles can not be split
+        if (bestAxis == -1) continue;
+
+        Vector3 size = Vector3Subtract(box.max, box.min);
+        float area = size.x*size.y + size.y*size.z + size.z*size.x;
+        if ((count <= MESH_BVH_LEAF_TRIANGLES) && ((area + bestCost) >= (count*area))) continue;
+
+        // Partition triangles in-place, bins lower than split go to left child
+        float axisMin = (bestAxis == 0)? centroidMin.x : (bestAxis == 1)? centroidMin.y : centroidMin.z;
+        float axisMax = (bestAxis == 0)? centroidMax.x : (bestAxis == 1)? centroidMax.y : centroidMax.z;
+        float binScale = MESH_BVH_SAH_BINS/(axisMax - axisMin);
+        int left = first;
+        int right = first + count - 1;
+
+        while (left <= right)
+        {
+            float centroid = (bestAxis == 0)? centroids[indices[left]].x : (bestAxis == 1)? centroids[indices[left]].y : centroids[indices[left]].z;
+            int bin = (int)((centroid - axisMin)*binScale);
+
+            if (bin < bestSplit) left++;
+            else
+            {
+                int temp = indices[left];
+                indices[left] = indices[right];
+                indices[right] = temp;
+                right--;
+            }
+        }
+
+        int leftCount = left - first;
+        if ((leftCount == 0) || (leftCount == count)) continue;
+
+        nodes[nodeIndex].first = nodeCount;
+        nodes[nodeIndex].count = 0;
+
+        // Push right child first, so left child is processed next (depth-first)
+        stack[stackSize].node = nodeCount + 1;
+        stack[stackSize].first = left;
+        stack[stackSize].count = count - leftCount;
+        stack[stackSize].depth = depth + 1;
+        stackSize++;
+
+        stack[stackSize].node = nodeCount;
+        stack[stackSize].first = first;
+        stack[stackSize].count = leftCount;
+        stack[stackSize].depth = depth + 1;
+        stackSize++;
+
+        nodeCount += 2;
+    }
+
+    // Copy triangles in leaves order, leaves reference them by their position in partitioned indices
+    float *triangles = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        int t = indices[i];
+        Vector3 a = vertices[(mesh->indices != NULL)? mesh->indices[t*3 + 0] : t*3 + 0];
+        Vector3 b = vertices[(mesh->indices != NULL)? mesh->indices[t*3 + 1] : t*3 + 1];
+        Vector3 c = vertices[(mesh->indices != NULL)? mesh->indices[t*3 + 2] : t*3 + 2];
+        Vector3 edge1 = Vector3Subtract(b, a);
+        Vector3 edge2 = Vector3Subtract(c, a);
+
+        memcpy(triangles + i*9, &a, sizeof(Vector3));
+        memcpy(triangles + i*9 + 3, &edge1, sizeof(Vector3));
+        memcpy(triangles + i*9 + 6, &edge2, sizeof(Vector3));
+    }
+
+    RL_FREE(indices);
+    RL_FREE(bounds);
+    RL_FREE(centroids);
+
+    mesh->bvh = (rMeshBVH *)RL_MALLOC(sizeof(rMeshBVH));
+    mesh->bvh->nodeCount = nodeCount;
+    mesh->bvh->nodes = (MeshBVHNode *)RL_REALLOC(nodes, nodeCount*sizeof(MeshBVHNode));
+    mesh->bvh->triangleCount = triangleCount;
+    mesh->bvh->triangles = triangles;
+
+    TRACELOG(LOG_INFO, "MESH: BVH generated successfully (%i triangles | %i nodes)", triangleCount, nodeCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -4067,46 +4507,92 @@ RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and mesh
+// NOTE: Ray is transformed into mesh space, triangles are tested through mesh BVH if available [GenMeshBVH()]
 RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
 {
     RayCollision collision = { 0 };
 
+    GetRayCollisionMeshBatch(&ray, 1, mesh, transform, &collision);
+
+    return collision;
+}
+
+// Get collision info between multiple rays and mesh, results stored in collisions array
+// NOTE: Mesh transform inverse is computed once for all rays
+void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions)
+{
     // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+    if (mesh.vertices == NULL)
     {
-        int triangleCount = mesh.triangleCount;
+        for (int i = 0; i < rayCount; i++) collisions[i] = (RayCollision){ 0 };
+        return;
+    }
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
-        {
-            Vector3 a, b, c;
-            Vector3 *vertdata = (Vector3 *)mesh.vertices;
+    float det = MatrixDeterminant(transform);
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+    // Transform can not be inverted (mesh flattened), test triangles in world space
+    if (det == 0.0f)
+    {
+        for (int i = 0; i < rayCount; i++) collisions[i] = GetRayCollisionMeshWorld(rays[i], mesh, transform);
+        return;
+    }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+    Matrix invTransform = MatrixInvert(transform);
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+    // Normals are transformed by inverse transpose, flipped for mirroring transforms to keep counter-clockwise winding normal
+    Matrix normalMatrix = MatrixTranspose(invTransform);
+    if (det < 0.0f) normalMatrix = MatrixMultiply(normalMatrix, MatrixScale(-1.0f, -1.0f, -1.0f));
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
-            }
+    for (int i = 0; i < rayCount; i++)
+    {
+        RayCollision collision = { 0 };
+        Ray ray = rays[i];
+
+        // NOTE: Direction is transformed without translation and normalized,
+        // mesh space hit distance is converted back to world distance with direction length
+        Vector3 origin = Vector3Transform(ray.position, invTransform);
+        Vector3 direction = {
+            invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z,
+            invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z,
+            invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z
+        };
+
+        float directionLength = Vector3Length(direction);
+        if (directionLength == 0.0f) { collisions[i] = collision; continue; }
+        direction = Vector3Scale(direction, 1.0f/directionLength);
+
+        float distance = 0.0f;
+        Vector3 normal = { 0 };
+
+        if (GetRayCollisionMeshLocal(origin, direction, mesh, &distance, &normal) >= 0)
+        {
+            distance /= directionLength;
+
+            collision.hit = true;
+            collision.distance = distance;
+            collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+            collision.normal = Vector3Normalize((Vector3){
+                normalMatrix.m0*normal.x + normalMatrix.m4*normal.y + normalMatrix.m8*normal.z,
+                normalMatrix.m1*normal.x + normalMatrix.m5*normal.y + normalMatrix.m9*normal.z,
+                normalMatrix.m2*normal.x + normalMatrix.m6*normal.y + normalMatrix.m10*normal.z });
         }
+
+        collisions[i] = collision;
+    }
+}
+
+// Get collision info between ray and model
+// NOTE: Closest hit of all model meshes, using model transform
+RayCollision GetRayCollisionModel(Ray ray, Model model)
+{
+    RayCollision collision = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        RayCollision meshHitInfo = GetRayCollisionMesh(ray, model.meshes[i], model.transform);
+
+        // Save the closest hit mesh
+        if (meshHitInfo.hit && ((!collision.hit) || (collision.distance > meshHitInfo.distance))) collision = meshHitInfo;
     }
 
     return collision;
@@ -4188,6 +4674,319 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Unload mesh BVH data
+static void UnloadMeshBVH(rMeshBVH *bvh)
+{
+    if (bvh != NULL)
+    {
+        RL_FREE(bvh->nodes);
+        RL_FREE(bvh->triangles);
+        RL_FREE(bvh);
+    }
+}
+
+// Get collision info between ray and mesh, testing all triangles transformed into world space
+static RayCollision GetRayCollisionMeshWorld(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Load model skeleton runtime data, inverse bind pose
+static rModelSkeleton *LoadModelSkeleton(const Transform *bindPose, int boneCount)
+{
+    rModelSkeleton *skeleton = (rModelSkeleton *)RL_CALLOC(1, sizeof(rModelSkeleton));
+
+    skeleton->boneCount = boneCount;
+    skeleton->invBindPose = (Transform *)RL_MALLOC(boneCount*sizeof(Transform));
+
+    for (int i = 0; i < boneCount; i++) skeleton->invBindPose[i] = GetBindPoseInverse(bindPose[i]);
+
+    return skeleton;
+}
+
+// Get bone bind pose inverse transform (rotation, translation and scale inverted)
+static Transform GetBindPoseInverse(Transform bindPose)
+{
+    Transform invBindPose = { 0 };
+    Quaternion invRotation = QuaternionInvert(bindPose.rotation);
+
+    invBindPose.rotation = invRotation;
+    invBindPose.translation = Vector3RotateByQuaternion(Vector3Negate(bindPose.translation), invRotation);
+    invBindPose.scale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, bindPose.scale);
+
+    return invBindPose;
+}
+
+// Unload model skeleton runtime data
+static void UnloadModelSkeleton(rModelSkeleton *skeleton)
+{
+    if (skeleton != NULL)
+    {
+        RL_FREE(skeleton->invBindPose);
+        RL_FREE(skeleton);
+    }
+}
+
+// Skin a range of mesh vertices (linear blend skinning), thread entry point
+// NOTE 1: The 4 bones transforms of every vertex are blended first and applied once,
+// fixed size loops over transform elements can be vectorized by compiler
+// NOTE 2: Influences with zero weight use zero transform at index 256 (branchless select),
+// unused bone ids could point to non-finite transforms and 0*NaN would spread to vertex
+static void *UpdateMeshSkinning(void *batch)
+{
+    const MeshSkinningBatch *data = (const MeshSkinningBatch *)batch;
+    const float *vertices = data->vertices;
+    const float *normals = data->normals;
+    float *animVertices = data->animVertices;
+    float *animNormals = data->animNormals;
+
+    for (int i = data->first; i < data->first + data->count; i++)
+    {
+        const unsigned char *ids = data->boneIds + i*4;
+        const float *weights = data->boneWeights + i*4;
+        const int id0 = (ids[0]*(weights[0] != 0.0f) + 256*(weights[0] == 0.0f))*12;
+        const int id1 = (ids[1]*(weights[1] != 0.0f) + 256*(weights[1] == 0.0f))*12;
+        const int id2 = (ids[2]*(weights[2] != 0.0f) + 256*(weights[2] == 0.0f))*12;
+        const int id3 = (ids[3]*(weights[3] != 0.0f) + 256*(weights[3] == 0.0f))*12;
+        const float *bone0 = data->bones + id0;
+        const float *bone1 = data->bones + id1;
+        const float *bone2 = data->bones + id2;
+        const float *bone3 = data->bones + id3;
+        float transform[12] = { 0 };
+
+        for (int k = 0; k < 12; k++) transform[k] = weights[0]*bone0[k] + weights[1]*bone1[k] + weights[2]*bone2[k] + weights[3]*bone3[k];
+
+        float x = vertices[i*3];
+        float y = vertices[i*3 + 1];
+        float z = vertices[i*3 + 2];
+
+        animVertices[i*3] = transform[0]*x + transform[1]*y + transform[2]*z + transform[3];
+        animVertices[i*3 + 1] = transform[4]*x + transform[5]*y + transform[6]*z + transform[7];
+        animVertices[i*3 + 2] = transform[8]*x + transform[9]*y + transform[10]*z + transform[11];
+
+        // Normals processing
+        // NOTE: We use base normals (default normal) to calculate animated normals
+        if (normals != NULL)
+        {
+            const float *normalBone0 = data->normalBones + id0;
+            const float *normalBone1 = data->normalBones + id1;
+            const float *normalBone2 = data->normalBones + id2;
+            const float *normalBone3 = data->normalBones + id3;
+            float normalTransform[12] = { 0 };
+
+            for (int k = 0; k < 12; k++) normalTransform[k] = weights[0]*normalBone0[k] + weights[1]*normalBone1[k] + weights[2]*normalBone2[k] + weights[3]*normalBone3[k];
+
+            x = normals[i*3];
+            y = normals[i*3 + 1];
+            z = normals[i*3 + 2];
+
+            animNormals[i*3] = normalTransform[0]*x + normalTransform[1]*y + normalTransform[2]*z;
+            animNormals[i*3 + 1] = normalTransform[4]*x + normalTransform[5]*y + normalTransform[6]*z;
+            animNormals[i*3 + 2] = normalTransform[8]*x + normalTransform[9]*y + normalTransform[10]*z;
+        }
+    }
+
+    return NULL;
+}
+
+// Get ray distance to triangle, defined by first vertex and two edges from it
+// NOTE: Same test as GetRayCollisionTriangle(), without computing collision point and normal,
+// parallel rays are rejected with an epsilon relative to triangle size (direction expected normalized)
+static bool GetRayTriangleDistance(Vector3 origin, Vector3 direction, Vector3 v0, Vector3 edge1, Vector3 edge2, float *distance)
+{
+    Vector3 p = Vector3CrossProduct(direction, edge2);
+    float det = Vector3DotProduct(edge1, p);
+
+    if (fabsf(det) <= EPSILON*(Vector3DotProduct(edge1, edge1) + Vector3DotProduct(edge2, edge2))) return false;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = Vector3Subtract(origin, v0);
+    float u = Vector3DotProduct(tv, p)*invDet;
+
+    if ((u < 0.0f) || (u > 1.0f)) return false;
+
+    Vector3 q = Vector3CrossProduct(tv, edge1);
+    float v = Vector3DotProduct(direction, q)*invDet;
+
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return false;
+
+    *distance = Vector3DotProduct(edge2, q)*invDet;
+
+    return (*distance > 0.0f);
+}
+
+// Get ray entry distance to box (slabs test), only if lower than maxDistance
+// NOTE: Ray inverse direction is provided, infinite values for axis-parallel rays are handled by min/max
+static bool GetRayBoxDistance(Vector3 origin, Vector3 invDirection, Vector3 min, Vector3 max, float maxDistance, float *distance)
+{
+    float t1 = (min.x - origin.x)*invDirection.x;
+    float t2 = (max.x - origin.x)*invDirection.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (min.y - origin.y)*invDirection.y;
+    t2 = (max.y - origin.y)*invDirection.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (min.z - origin.z)*invDirection.z;
+    t2 = (max.z - origin.z)*invDirection.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    *distance = tmin;
+
+    return ((tmax >= tmin) && (tmax >= 0.0f) && (tmin < maxDistance));
+}
+
+// Get closest triangle hit by ray in mesh space, returns triangle index or -1 if none
+// NOTE: Returned normal is not normalized (edges cross product)
+static int GetRayCollisionMeshLocal(Vector3 origin, Vector3 direction, Mesh mesh, float *distance, Vector3 *normal)
+{
+    int closest = -1;
+    float closestDistance = 0.0f;
+    float t = 0.0f;
+
+    if (mesh.bvh == NULL)
+    {
+        // Test against all triangles in mesh
+        Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+        for (int i = 0; i < mesh.triangleCount; i++)
+        {
+            Vector3 a = vertdata[(mesh.indices != NULL)? mesh.indices[i*3 + 0] : i*3 + 0];
+            Vector3 b = vertdata[(mesh.indices != NULL)? mesh.indices[i*3 + 1] : i*3 + 1];
+            Vector3 c = vertdata[(mesh.indices != NULL)? mesh.indices[i*3 + 2] : i*3 + 2];
+            Vector3 edge1 = Vector3Subtract(b, a);
+            Vector3 edge2 = Vector3Subtract(c, a);
+
+            if (GetRayTriangleDistance(origin, direction, a, edge1, edge2, &t) && ((closest == -1) || (t < closestDistance)))
+            {
+                closest = i;
+                closestDistance = t;
+                *normal = Vector3CrossProduct(edge1, edge2);
+            }
+        }
+    }
+    else
+    {
+        // Traverse BVH, closest child first, skipping nodes farther than closest hit found
+        const MeshBVHNode *nodes = mesh.bvh->nodes;
+        const Vector3 *triangles = (const Vector3 *)mesh.bvh->triangles;
+        Vector3 invDirection = { 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+        float maxDistance = FLT_MAX;
+
+        int stack[MESH_BVH_MAX_DEPTH];
+        float stackDistances[MESH_BVH_MAX_DEPTH];
+        int stackSize = 0;
+        int node = 0;
+
+        if (!GetRayBoxDistance(origin, invDirection, nodes[0].min, nodes[0].max, maxDistance, &t)) node = -1;
+
+        while (node >= 0)
+        {
+            if (nodes[node].count > 0)
+            {
+                for (int i = nodes[node].first; i < nodes[node].first + nodes[node].count; i++)
+                {
+                    if (GetRayTriangleDistance(origin, direction, triangles[i*3], triangles[i*3 + 1], triangles[i*3 + 2], &t) && (t < maxDistance))
+                    {
+                        closest = i;
+                        maxDistance = t;
+                    }
+                }
+
+                node = -1;
+            }
+            else
+            {
+                int near = nodes[node].first;
+                int far = near + 1;
+                float nearDistance = 0.0f;
+                float farDistance = 0.0f;
+                bool nearHit = GetRayBoxDistance(origin, invDirection, nodes[near].min, nodes[near].max, maxDistance, &nearDistance);
+                bool farHit = GetRayBoxDistance(origin, invDirection, nodes[far].min, nodes[far].max, maxDistance, &farDistance);
+
+                if (nearHit && farHit && (farDistance < nearDistance))
+                {
+                    int temp = near;
+                    near = far;
+                    far = temp;
+                    t = nearDistance;
+                    nearDistance = farDistance;
+                    farDistance = t;
+                }
+
+                if (nearHit && farHit)
+                {
+                    stack[stackSize] = far;
+                    stackDistances[stackSize] = farDistance;
+                    stackSize++;
+                }
+
+                node = (nearHit)? near : (farHit)? far : -1;
+            }
+
+            // Pop next node, skipping the ones farther than closest hit found
+            while ((node == -1) && (stackSize > 0))
+            {
+                stackSize--;
+                if (stackDistances[stackSize] < maxDistance) node = stack[stackSize];
+            }
+        }
+
+        if (closest >= 0)
+        {
+            closestDistance = maxDistance;
+            *normal = Vector3CrossProduct(triangles[closest*3 + 1], triangles[closest*3 + 2]);
+        }
+    }
+
+    *distance = closestDistance;
+
+    return closest;
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
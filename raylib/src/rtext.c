@@ -21,6 +21,20 @@
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [SetShapesTexture()].
 *
+*       #define SUPPORT_FONT_DATA_THREADS
+*           On font data loading [LoadFontData()], rasterize glyphs in parallel using multiple threads,
+*           useful for big charsets and SDF fonts. Requires POSIX threads (pthreads).
+*
+*       #define SUPPORT_FONT_KERNING
+*           On TTF/OTF font loading, extract kerning pairs (GPOS or kern table) for the loaded glyphs
+*           into a lookup table, kerning is applied when measuring and drawing text.
+*
+*       #define SUPPORT_FONT_CACHE
+*           On TTF/OTF font loading [LoadFontFromMemory()], save generated font into a binary font file
+*           in FONT_CACHE_DIRECTORY, next loads with same font data, size and codepoints use that file,
+*           no glyphs rasterization or atlas packing required.
+*           NOTE: FONT_CACHE_DIRECTORY is relative to current working directory if not absolute
+*
 *       #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *           TextSplit() function static buffer max size
 *
@@ -100,6 +114,10 @@
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic pop
     #endif
+
+    #if defined(SUPPORT_FONT_DATA_THREADS)
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join() [Used in LoadFontData()]
+    #endif
 #endif
 
 //----------------------------------------------------------------------------------
@@ -115,11 +133,148 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_GLYPHS_BATCH
+    #define MAX_TEXT_GLYPHS_BATCH                256        // Maximum number of glyphs quads emitted together: DrawTextEx(), DrawTextCodepoints()
+#endif
+#ifndef FONT_DATA_MAX_THREADS
+    #define FONT_DATA_MAX_THREADS                  8        // Maximum number of threads rasterizing glyphs: LoadFontData() [SUPPORT_FONT_DATA_THREADS]
+#endif
+#ifndef FONT_DATA_THREAD_MIN_GLYPHS
+    #define FONT_DATA_THREAD_MIN_GLYPHS           64        // Minimum number of glyphs per thread: LoadFontData() [SUPPORT_FONT_DATA_THREADS]
+#endif
+#ifndef FONT_DYNAMIC_DEFAULT_ATLAS_SIZE
+    #define FONT_DYNAMIC_DEFAULT_ATLAS_SIZE     1024        // Dynamic font default atlas size: LoadFontDynamic()
+#endif
+#ifndef FONT_KERNING_MAX_GLYPHS
+    #define FONT_KERNING_MAX_GLYPHS              512        // Maximum number of glyphs checked for kerning pairs, first ones in font [SUPPORT_FONT_KERNING]
+#endif
+#ifndef FONT_CACHE_DIRECTORY
+    #define FONT_CACHE_DIRECTORY         "fontcache"        // Directory for font cache files, relative to working directory [SUPPORT_FONT_CACHE]
+#endif
+
+#define FONT_BINARY_VERSION                      100        // Binary font file format version: ExportFontBinary(), LoadFontBinary()
+
+// Thread local storage for static buffers, every thread gets its own copy: TextFormat(), TextSplit()...
+// WARNING: Compilers without thread local storage support share static buffers between threads,
+// text functions returning static buffers must be called from a single thread in that case
+#if defined(_MSC_VER)
+    #define TEXT_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define TEXT_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+    #define TEXT_THREAD_LOCAL __thread
+#else
+    #define TEXT_THREAD_LOCAL
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Glyphs lookup table, codepoint to glyph index
+// NOTE: Basic Multilingual Plane codepoints use a direct table (pages of 256 entries, allocated on demand),
+// codepoints out of it use an open addressing hash table
+struct rGlyphLookup {
+    int fallbackIndex;          // Glyph index for codepoints not available in font ('?' glyph or 0)
+    int *pages[256];            // Direct table pages, glyph index or -1 if codepoint not available
+    int hashCapacity;           // Hash table capacity (power of two), 0 if not required
+    int *hashCodepoints;        // Hash table keys, codepoints (-1 for empty slots)
+    int *hashIndices;           // Hash table values, glyph indices
+    struct rFontDynamic *dynamic; // Dynamic font data, glyphs rasterized on demand (NULL for static fonts)
+    int type;                   // Font type, atlas content: FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF
+    int kerningCapacity;        // Kerning hash table capacity (power of two), 0 if no kerning pairs
+    int *kerningFirst;          // Kerning hash table keys, first codepoint of pair (-1 for empty slots)
+    int *kerningSecond;         // Kerning hash table keys, second codepoint of pair
+    float *kerningValues;       // Kerning hash table values, advance adjustment in pixels (font base size)
+};
+
+// Binary font file header, followed by data sections
+// NOTE: Data is stored as used in memory (little-endian), sections are aligned to 16 bytes,
+// file data can be used directly (i.e. memory-mapped) without any parsing
+typedef struct FontBinaryHeader {
+    char id[4];                 // File identifier: "rFNB"
+    int version;                // Format version: FONT_BINARY_VERSION
+    int baseSize;               // Font base size
+    int glyphCount;             // Number of glyphs
+    int glyphPadding;           // Glyphs padding in atlas
+    int type;                   // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF
+    int atlasWidth;             // Atlas width
+    int atlasHeight;            // Atlas height
+    int atlasFormat;            // Atlas pixel format (PixelFormat)
+    int kerningCount;           // Number of kerning pairs
+    int glyphsOffset;           // Glyphs info offset: value, offsetX, offsetY, advanceX (int, glyphCount*16 bytes)
+    int recsOffset;             // Glyphs rectangles offset (Rectangle, glyphCount*16 bytes)
+    int kerningOffset;          // Kerning pairs offset: first codepoint, second codepoint (int), value (float)
+    int atlasOffset;            // Atlas pixels offset
+    int atlasDataSize;          // Atlas pixels size in bytes
+    int reserved;               // Reserved, header size is 64 bytes
+} FontBinaryHeader;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization batch: glyphs first, first + step, first + 2*step...
+typedef struct FontGlyphsBatch {
+    const stbtt_fontinfo *fontInfo; // Font info (read-only)
+    const int *codepoints;      // Codepoints to rasterize
+    GlyphInfo *glyphs;          // Glyphs info output, one per codepoint
+    int count;                  // Codepoints count
+    int fontSize;               // Font size in pixels
+    float scaleFactor;          // Font scale factor for font size
+    int ascent;                 // Font ascent in font units
+    int type;                   // Font type (FONT_DEFAULT, FONT_BITMAP, FONT_SDF, FONT_MSDF)
+    int first;                  // First glyph in batch
+    int step;                   // Glyphs step in batch
+} FontGlyphsBatch;
+
+// Glyph outline edge, used for MSDF generation
+typedef struct GlyphEdge {
+    Vector2 points[4];          // Edge control points, in glyph image pixels
+    int degree;                 // Edge degree: 1-Line, 2-Quadratic bezier, 3-Cubic bezier
+    int color;                  // Edge channels mask: 1-Red, 2-Green, 4-Blue
+    Rectangle bounds;           // Control points bounding box, used to skip far edges
+} GlyphEdge;
+
+// Dynamic font internal data
+// NOTE: Atlas is divided in shelves (rows of fixed height), glyphs are appended into shelves,
+// when atlas is full (or no glyph slot is free) the least recently used shelf is evicted as a whole
+typedef struct rFontDynamic {
+    unsigned char *fileData;    // Font file data copy, required by stb_truetype to rasterize glyphs
+    stbtt_fontinfo fontInfo;    // Font info for glyphs rasterization
+    float scaleFactor;          // Font scale factor for requested font size
+    int ascent;                 // Font ascent in pixels (baseline)
+    int atlasSize;              // Atlas texture size in pixels (square)
+    int shelfHeight;            // Shelves height in pixels, including glyphs padding
+    int shelfCount;             // Number of shelves in atlas
+    int *shelfOffset;           // Shelves horizontal space already used
+    unsigned int *shelfLastUse; // Shelves last use stamp (LRU eviction)
+    int *glyphShelf;            // Shelf containing every glyph slot, -1 for free slots, -2 for fallback glyph slot (never evicted)
+    int fallbackWidth;          // Fallback glyph width reserved at shelf 0 start, including padding
+    unsigned int useCounter;    // Glyphs use counter
+    int hashUsed;               // Hash table entries used, including removed ones
+} rFontDynamic;
+#endif
+
+// Text view line
+typedef struct TextViewLine {
+    char *text;                 // Line text, NULL terminated, no line break
+    int length;                 // Line text length in bytes
+    int capacity;               // Line text allocated size in bytes
+    int rowCount;               // Number of rows, line wrapped
+    int *rowStart;              // Rows first byte, NULL if line takes a single row
+} TextViewLine;
+
+// Text view internal data
+// NOTE: Rows index is a Fenwick tree over lines rows count, that way mapping
+// between rows (vertical offset) and lines, and updating one line rows count, is O(log n)
+struct rTextViewData {
+    Font font;                  // Font used for layout
+    float fontSize;             // Font size used for layout
+    float spacing;              // Glyphs spacing used for layout
+    float wrapWidth;            // Lines wrapping width, 0 for no wrapping
+    int lineCount;              // Number of lines
+    int lineCapacity;           // Number of lines allocated
+    TextViewLine *lines;        // Lines data
+    int *rowIndex;              // Rows index, Fenwick tree (1-based, lineCapacity + 1 entries)
+    int rowCount;               // Total number of rows
+};
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -130,6 +285,11 @@ extern bool isGpuReady;
 // NOTE: Default font is loaded on InitWindow() and disposed on CloseWindow() [module: core]
 static Font defaultFont = { 0 };
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Built-in shader for SDF fonts, loaded on first use
+// NOTE: Shader is disposed on CloseWindow(), along with default font
+static Shader textShaderSDF = { 0 };
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -147,10 +307,48 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 #endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount); // Load glyphs lookup table (codepoint to glyph index)
+static void UnloadGlyphLookup(rGlyphLookup *lookup);                          // Unload glyphs lookup table
+static int GetLookupIndex(const rGlyphLookup *lookup, int codepoint);          // Get glyph index from lookup table, -1 if codepoint not in table
+static bool IsGlyphLoadRequired(Font font, int codepoint);                     // Check if glyph must be rasterized on lookup (dynamic fonts), could evict other glyphs
+static float GetLookupKerning(const rGlyphLookup *lookup, int codepoint, int nextCodepoint); // Get kerning for codepoints pair from lookup table
+static void LoadKerningTable(rGlyphLookup *lookup, const int *pairs, const float *values, int pairCount); // Load kerning hash table from pairs
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font from memory buffer with generation type
+static Font LoadFontBinaryData(const unsigned char *fileData, int dataSize);   // Load binary font data, empty font on failure
+static bool SaveFontBinary(Font font, Image atlas, int type, const char *fileName); // Save binary font file from font and atlas image
+static void DrawTextGlyphs(Font font, const int *indices, const Vector2 *positions, int count, Vector2 origin, float fontSize, Color tint); // Draw glyphs quads in bulk
+static bool BeginTextShaderSDF(Font font);                                     // Enable built-in SDF shader for SDF fonts, if no custom shader enabled
+static void DrawTextBytes(Font font, const char *text, int size, Vector2 position, float fontSize, float spacing, Color tint); // Draw text bytes, not NULL terminated
+static void ReplaceTextViewLineText(TextViewLine *line, int start, int removeCount, const char *text, int insertCount); // Replace text view line bytes
+static void WrapTextViewLine(rTextViewData *data, TextViewLine *line);        // Wrap text view line, rows start cached
+static void InsertTextViewLines(rTextViewData *data, int line, int count);    // Insert empty lines in text view
+static void BuildTextViewRows(rTextViewData *data);                           // Build text view rows index, O(n)
+static void UpdateTextViewRows(rTextViewData *data, int line, int delta);     // Update text view rows index for one line rows count change, O(log n)
+static int GetTextViewRowsBefore(rTextViewData *data, int line);              // Get text view rows count before line, O(log n)
+static int GetTextViewRowLine(rTextViewData *data, int row, int *lineRow);    // Get text view line containing row and row in line, O(log n)
+static void AppendTextBuilderBytes(TextBuilder *builder, const char *text, int length); // Append text bytes to builder, truncated if it does not fit
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void *LoadFontGlyphs(void *batch);                                      // Rasterize a batch of glyphs, thread entry point [SUPPORT_FONT_DATA_THREADS]
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scaleFactor, int index, int padding, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph multi-channel SDF (RGB)
+static Vector2 GetGlyphEdgePoint(const GlyphEdge *edge, float t);             // Get glyph edge point at parameter t
+static Vector2 GetGlyphEdgeDirection(const GlyphEdge *edge, float t);         // Get glyph edge direction (derivative) at parameter t
+static float GetGlyphEdgeDistance(const GlyphEdge *edge, Vector2 point, float *param, float *dot); // Get signed distance from point to glyph edge
+static float GetGlyphEdgePseudoDistance(const GlyphEdge *edge, Vector2 point, float distance, float param); // Get pseudo-distance, edge ends extended
+static bool IsGlyphMSDFClash(const float *a, const float *b, float threshold); // Check if MSDF texels channels clash (interpolation artifacts)
+static int SolveCubic(double *roots, double a, double b, double c, double d);  // Solve cubic equation real roots, returns roots count
+static void SetGlyphLookupIndex(Font font, int codepoint, int index);          // Set dynamic font lookup table entry, -1 to remove it
+static int LoadFontDynamicGlyph(Font font, int codepoint);                     // Rasterize glyph into dynamic font atlas, returns glyph index or -1
+static void EvictFontDynamicShelf(Font font, int shelf);                       // Evict all glyphs in a dynamic font atlas shelf
+#if defined(SUPPORT_FONT_KERNING)
+static void LoadGlyphKerning(rGlyphLookup *lookup, const stbtt_fontinfo *fontInfo, float scaleFactor, const int *codepoints, int codepointCount); // Load kerning pairs into lookup table
+#endif
+#endif
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
+extern void UnloadTextResources(void);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -305,6 +503,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.lookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -316,9 +515,19 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.lookup);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
+// Unload text module GPU resources (built-in SDF shader), called on CloseWindow()
+extern void UnloadTextResources(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (textShaderSDF.id > 0) UnloadShader(textShaderSDF);
+    textShaderSDF = (Shader){ 0 };
+#endif
+}
+
 // Get the default font, useful to be used with extended parameters
 Font GetFontDefault()
 {
@@ -523,14 +732,57 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
 
 // Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
 Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount)
+{
+    return LoadFontFromMemoryType(fileType, fileData, dataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+}
+
+// Load SDF font from file (TTF/OTF), type: FONT_SDF or FONT_MSDF
+// NOTE: Atlas generated at fontSize can be drawn at any size, SDF fonts are drawn with a
+// built-in shader unless a custom shader is enabled, MSDF keeps glyphs sharp corners
+Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type)
+{
+    Font font = { 0 };
+
+    if ((type != FONT_SDF) && (type != FONT_MSDF))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] SDF font type not valid, using FONT_MSDF", fileName);
+        type = FONT_MSDF;
+    }
+
+    if (IsFileExtension(fileName, ".ttf;.otf"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL)
+        {
+            font = LoadFontFromMemoryType(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount, type);
+            UnloadFileData(fileData);
+        }
+        else font = GetFontDefault();
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] SDF fonts require TTF/OTF font data", fileName);
+        font = GetFontDefault();
+    }
+
+    return font;
+}
+
+// Load font from memory buffer with generation type
+// NOTE: Generation type only applies to TTF/OTF data
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
     Font font = { 0 };
+    int fontType = FONT_DEFAULT;
 
     char fileExtLower[16] = { 0 };
     strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
@@ -539,11 +791,52 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
     font.glyphPadding = 0;
 
+#if defined(SUPPORT_FONT_CACHE) && defined(SUPPORT_FILEFORMAT_TTF)
+    // Font cache file name from font data size and hash, font size and codepoints
+    // NOTE: Cached font size and codepoints are checked on load, a hash collision regenerates the font
+    char cacheFileName[256] = { 0 };
+
+    if (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf"))
+    {
+        unsigned int dataHash = ComputeCRC32((unsigned char *)fileData, dataSize);
+        unsigned int codepointsHash = (codepoints != NULL)? ComputeCRC32((unsigned char *)codepoints, font.glyphCount*sizeof(int)) : 0;
+        snprintf(cacheFileName, 256, "%s/%08x_%i_%i_%i_%08x_%i.rfb", FONT_CACHE_DIRECTORY, dataHash, dataSize, fontSize, font.glyphCount, codepointsHash, type);
+
+        if (FileExists(cacheFileName))
+        {
+            int cacheDataSize = 0;
+            unsigned char *cacheData = LoadFileData(cacheFileName, &cacheDataSize);
+            Font cacheFont = LoadFontBinaryData(cacheData, cacheDataSize);
+            UnloadFileData(cacheData);
+
+            bool cacheValid = (cacheFont.glyphs != NULL) && (cacheFont.baseSize == fontSize) && (cacheFont.glyphCount == font.glyphCount);
+
+            for (int i = 0; cacheValid && (i < cacheFont.glyphCount); i++)
+            {
+                if (cacheFont.glyphs[i].value != ((codepoints != NULL)? codepoints[i] : (32 + i))) cacheValid = false;
+            }
+
+            if (!cacheValid && (cacheFont.glyphs != NULL))
+            {
+                TRACELOG(LOG_WARNING, "FONT: [%s] Font cache file does not match font, regenerated", cacheFileName);
+                UnloadFont(cacheFont);
+            }
+
+            if (cacheValid)
+            {
+                TRACELOG(LOG_INFO, "FONT: [%s] Font loaded from cache (%i pixel size | %i glyphs)", cacheFileName, cacheFont.baseSize, cacheFont.glyphCount);
+                return cacheFont;
+            }
+        }
+    }
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     if (TextIsEqual(fileExtLower, ".ttf") ||
         TextIsEqual(fileExtLower, ".otf"))
     {
-        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_DEFAULT);
+        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, type);
+        fontType = type;
     }
     else
 #endif
@@ -563,8 +856,14 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
-        if (isGpuReady) font.texture = LoadTextureFromImage(atlas);
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 1);
+        if (isGpuReady)
+        {
+            font.texture = LoadTextureFromImage(atlas);
+
+            // SDF fonts are scaled, distance is interpolated
+            if ((fontType == FONT_SDF) || (fontType == FONT_MSDF)) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+        }
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
         for (int i = 0; i < font.glyphCount; i++)
@@ -573,6 +872,31 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
             font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
         }
 
+        font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+        if (font.lookup != NULL) font.lookup->type = fontType;
+
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_KERNING)
+        stbtt_fontinfo fontInfo = { 0 };
+
+        if ((TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")) && stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0))
+        {
+            int *fontCodepoints = (int *)RL_MALLOC(font.glyphCount*sizeof(int));
+            for (int i = 0; i < font.glyphCount; i++) fontCodepoints[i] = font.glyphs[i].value;
+
+            LoadGlyphKerning(font.lookup, &fontInfo, stbtt_ScaleForPixelHeight(&fontInfo, (float)font.baseSize), fontCodepoints, font.glyphCount);
+
+            RL_FREE(fontCodepoints);
+        }
+#endif
+
+#if defined(SUPPORT_FONT_CACHE) && defined(SUPPORT_FILEFORMAT_TTF)
+        if (cacheFileName[0] != '\0')
+        {
+            if (!DirectoryExists(FONT_CACHE_DIRECTORY)) MakeDirectory(FONT_CACHE_DIRECTORY);
+            SaveFontBinary(font, atlas, fontType, cacheFileName);
+        }
+#endif
+
         UnloadImage(atlas);
 
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
@@ -585,6 +909,174 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from binary font file, atlas uploaded to GPU as is
+Font LoadFontBinary(const char *fileName)
+{
+    Font font = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font = LoadFontBinaryFromMemory(fileData, dataSize);
+
+        UnloadFileData(fileData);
+    }
+    else font = GetFontDefault();
+
+    return font;
+}
+
+// Load font from binary font data in memory, i.e. embedded or memory-mapped file
+Font LoadFontBinaryFromMemory(const unsigned char *fileData, int dataSize)
+{
+    Font font = LoadFontBinaryData(fileData, dataSize);
+
+    if (font.glyphs != NULL) TRACELOG(LOG_INFO, "FONT: Binary font loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: Binary font data not valid -> Using default font");
+        font = GetFontDefault();
+    }
+
+    return font;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load font for glyphs rasterization on demand (TTF/OTF)
+// NOTE: Glyphs are rasterized the first time they are drawn or measured and cached into a font atlas
+// of the provided size, least recently used glyphs are evicted when atlas is full
+Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, atlasSize);
+
+        UnloadFileData(fileData);
+    }
+
+    return font;
+}
+
+// Load font for glyphs rasterization on demand from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied, provided buffer can be freed
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+    if (!TextIsEqual(TextToLower(fileType), ".ttf") && !TextIsEqual(TextToLower(fileType), ".otf"))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF data -> Using default font");
+        return GetFontDefault();
+    }
+
+    if ((fileData == NULL) || (dataSize <= 0) || (fontSize <= 0)) return GetFontDefault();
+    if (atlasSize <= 0) atlasSize = FONT_DYNAMIC_DEFAULT_ATLAS_SIZE;
+
+    rFontDynamic *dynamic = (rFontDynamic *)RL_CALLOC(1, sizeof(rFontDynamic));
+
+    // NOTE: stb_truetype reads font data when rasterizing, a copy is kept
+    dynamic->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    memcpy(dynamic->fileData, fileData, dataSize);
+
+    if (!stbtt_InitFont(&dynamic->fontInfo, dynamic->fileData, 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data -> Using default font");
+        RL_FREE(dynamic->fileData);
+        RL_FREE(dynamic);
+        return GetFontDefault();
+    }
+
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&dynamic->fontInfo, &ascent, &descent, &lineGap);
+    dynamic->scaleFactor = stbtt_ScaleForPixelHeight(&dynamic->fontInfo, (float)fontSize);
+    dynamic->ascent = (int)((float)ascent*dynamic->scaleFactor);
+
+    // Shelves height from font bounding box, clamped to a reasonable range,
+    // glyphs taller than shelf height (if any) are cropped
+    int x0, y0, x1, y1;
+    stbtt_GetFontBoundingBox(&dynamic->fontInfo, &x0, &y0, &x1, &y1);
+    int glyphMaxHeight = (int)ceilf((float)(y1 - y0)*dynamic->scaleFactor) + 1;
+    if (glyphMaxHeight < fontSize) glyphMaxHeight = fontSize;
+    if (glyphMaxHeight > 2*fontSize) glyphMaxHeight = 2*fontSize;
+
+    font.baseSize = fontSize;
+    font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+    dynamic->atlasSize = atlasSize;
+    dynamic->shelfHeight = glyphMaxHeight + 2*font.glyphPadding;
+    dynamic->shelfCount = atlasSize/dynamic->shelfHeight;
+
+    if (dynamic->shelfCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas too small for font size (%i) -> Using default font", fontSize);
+        RL_FREE(dynamic->fileData);
+        RL_FREE(dynamic);
+        return GetFontDefault();
+    }
+
+    dynamic->shelfOffset = (int *)RL_CALLOC(dynamic->shelfCount, sizeof(int));
+    dynamic->shelfLastUse = (unsigned int *)RL_CALLOC(dynamic->shelfCount, sizeof(unsigned int));
+
+    // Glyph slots, enough to fill the atlas with glyphs of half shelf width
+    // NOTE: Slots are reused on eviction, so glyphs/recs pointers keep valid for all font copies
+    font.glyphCount = dynamic->shelfCount*(atlasSize/(dynamic->shelfHeight/2));
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
+    dynamic->glyphShelf = (int *)RL_MALLOC(font.glyphCount*sizeof(int));
+    for (int i = 0; i < font.glyphCount; i++) dynamic->glyphShelf[i] = -1;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+    lookup->hashCapacity = 16;
+    while (lookup->hashCapacity < 2*font.glyphCount) lookup->hashCapacity *= 2;
+    lookup->hashCodepoints = (int *)RL_MALLOC(lookup->hashCapacity*sizeof(int));
+    lookup->hashIndices = (int *)RL_MALLOC(lookup->hashCapacity*sizeof(int));
+    for (int i = 0; i < lookup->hashCapacity; i++) lookup->hashCodepoints[i] = -1;
+    lookup->dynamic = dynamic;
+    font.lookup = lookup;
+
+    if (isGpuReady)
+    {
+        Image atlas = { 0 };
+        atlas.data = RL_CALLOC(atlasSize*atlasSize, 2);
+        atlas.width = atlasSize;
+        atlas.height = atlasSize;
+        atlas.mipmaps = 1;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+        font.texture = LoadTextureFromImage(atlas);
+        UnloadImage(atlas);
+    }
+
+#if defined(SUPPORT_FONT_KERNING)
+    // Kerning pairs for Basic Latin and Latin-1 Supplement, glyphs rasterized on demand can not be known in advance
+    int kerningCodepoints[95 + 96] = { 0 };
+    for (int i = 0; i < 95; i++) kerningCodepoints[i] = 32 + i;
+    for (int i = 0; i < 96; i++) kerningCodepoints[95 + i] = 160 + i;
+
+    LoadGlyphKerning(lookup, &dynamic->fontInfo, dynamic->scaleFactor, kerningCodepoints, 95 + 96);
+#endif
+
+    // Fallback glyph '?' is always resident: first glyph slot and shelf 0 start are reserved for it,
+    // the rest of shelf 0 is evicted as any other shelf (slot is kept empty if '?' is not available)
+    // NOTE: Atlas is empty, so fallback glyph is rasterized into slot 0 at shelf 0 start
+    lookup->fallbackIndex = 0;
+    LoadFontDynamicGlyph(font, 63);
+    dynamic->glyphShelf[0] = -2;
+    dynamic->fallbackWidth = dynamic->shelfOffset[0];
+
+    TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %ix%i atlas | %i glyph slots)", fontSize, atlasSize, atlasSize, font.glyphCount);
+
+    return font;
+}
+#endif
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -598,7 +1090,8 @@ bool IsFontValid(Font font)
 }
 
 // Load font data for further use
-// NOTE: Requires TTF font memory data and can generate SDF data
+// NOTE 1: Requires TTF font memory data and can generate SDF data
+// NOTE 2: FONT_MSDF generates RGB glyph images, distance is the median of the three channels
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
     // NOTE: Using some SDF generation default values,
@@ -650,82 +1143,48 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
+            // Rasterize glyphs, spread across worker threads if supported
+            // NOTE: stbtt_fontinfo is read-only after initialization and every glyph is
+            // written to its own GlyphInfo, so output does not depend on threads count
+            FontGlyphsBatch batch = { &fontInfo, codepoints, chars, codepointCount, fontSize, scaleFactor, ascent, type, 0, 1 };
 
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+#if defined(SUPPORT_FONT_DATA_THREADS)
+            // NOTE: SDF glyphs generation is much slower than rasterization, fewer glyphs per thread required
+            int threadCount = codepointCount/FONT_DATA_THREAD_MIN_GLYPHS;
+            if ((type == FONT_SDF) || (type == FONT_MSDF)) threadCount = codepointCount*8/FONT_DATA_THREAD_MIN_GLYPHS;
+            if (threadCount > FONT_DATA_MAX_THREADS) threadCount = FONT_DATA_MAX_THREADS;
 
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
+            if (threadCount > 1)
+            {
+                FontGlyphsBatch batches[FONT_DATA_MAX_THREADS] = { 0 };
+                pthread_t threads[FONT_DATA_MAX_THREADS] = { 0 };
+                bool threadRunning[FONT_DATA_MAX_THREADS] = { 0 };
 
-                if (index > 0)
+                // Glyphs are interleaved between batches, it balances glyphs complexity (codepoints ranges)
+                // NOTE: Batch 0 is processed by calling thread, batches failing to start too
+                for (int t = 0; t < threadCount; t++)
                 {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+                    batches[t] = batch;
+                    batches[t].first = t;
+                    batches[t].step = threadCount;
 
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
+                    if (t > 0) threadRunning[t] = (pthread_create(&threads[t], NULL, LoadFontGlyphs, &batches[t]) == 0);
+                }
 
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
+                for (int t = 0; t < threadCount; t++)
+                {
+                    if (!threadRunning[t]) LoadFontGlyphs(&batches[t]);
                 }
-                else
+
+                for (int t = 1; t < threadCount; t++)
                 {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
+                    if (threadRunning[t]) pthread_join(threads[t], NULL);
                 }
             }
+            else LoadFontGlyphs(&batch);
+#else
+            LoadFontGlyphs(&batch);
+#endif
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -737,7 +1196,9 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE 1: Packing method: 0-Default, 1-Skyline
+// NOTE 2: Skyline packing generates a NPOT atlas sized to glyphs, identical glyph bitmaps are packed once
+// NOTE 3: Grayscale glyphs generate a GRAY_ALPHA atlas, RGB glyphs (FONT_MSDF) generate a RGB atlas
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -757,58 +1218,92 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     // NOTE: Rectangles memory is loaded here!
     Rectangle *recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
 
-    // Calculate image size based on total glyph width and glyph row count
-    int totalWidth = 0;
-    int maxGlyphWidth = 0;
+    // Bytes per pixel, glyphs images are expected to share format
+    int bpp = 1;
+    for (int i = 0; i < glyphCount; i++) if (glyphs[i].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) bpp = 3;
 
-    for (int i = 0; i < glyphCount; i++)
+    if (packMethod == 0)   // Use basic packing algorithm
     {
-        if (glyphs[i].image.width > maxGlyphWidth) maxGlyphWidth = glyphs[i].image.width;
-        totalWidth += glyphs[i].image.width + 2*padding;
-    }
+        // Calculate image size based on total glyph width and glyph row count
+        int totalWidth = 0;
+        int maxGlyphWidth = 0;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (glyphs[i].image.width > maxGlyphWidth) maxGlyphWidth = glyphs[i].image.width;
+            totalWidth += glyphs[i].image.width + 2*padding;
+        }
 
 //#define SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE
 #if defined(SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE)
-    int rowCount = 0;
-    int imageSize = 64;  // Define minimum starting value to avoid unnecessary calculation steps for very small images
-
-    // NOTE: maxGlyphWidth is maximum possible space left at the end of row
-    while (totalWidth > (imageSize - maxGlyphWidth)*rowCount)
-    {
-        imageSize *= 2;                                 // Double the size of image (to keep POT)
-        rowCount = imageSize/(fontSize + 2*padding);    // Calculate new row count for the new image size
-    }
+        int rowCount = 0;
+        int imageSize = 64;  // Define minimum starting value to avoid unnecessary calculation steps for very small images
 
-    atlas.width = imageSize;   // Atlas bitmap width
-    atlas.height = imageSize;  // Atlas bitmap height
-#else
-    int paddedFontSize = fontSize + 2*padding;
-    // No need for a so-conservative atlas generation
-    float totalArea = totalWidth*paddedFontSize*1.2f;
-    float imageMinSize = sqrtf(totalArea);
-    int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
+        // NOTE: maxGlyphWidth is maximum possible space left at the end of row
+        while (totalWidth > (imageSize - maxGlyphWidth)*rowCount)
+        {
+            imageSize *= 2;                                 // Double the size of image (to keep POT)
+            rowCount = imageSize/(fontSize + 2*padding);    // Calculate new row count for the new image size
+        }
 
-    if (totalArea < ((imageSize*imageSize)/2))
-    {
-        atlas.width = imageSize;    // Atlas bitmap width
-        atlas.height = imageSize/2; // Atlas bitmap height
-    }
-    else
-    {
         atlas.width = imageSize;   // Atlas bitmap width
         atlas.height = imageSize;  // Atlas bitmap height
-    }
+#else
+        int paddedFontSize = fontSize + 2*padding;
+        // No need for a so-conservative atlas generation
+        float totalArea = totalWidth*paddedFontSize*1.2f;
+        float imageMinSize = sqrtf(totalArea);
+        int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
+        if (imageSize < 64) imageSize = 64;     // Minimum size, avoids zero sized atlas for empty glyphs
+
+        if (totalArea < ((imageSize*imageSize)/2))
+        {
+            atlas.width = imageSize;    // Atlas bitmap width
+            atlas.height = imageSize/2; // Atlas bitmap height
+        }
+        else
+        {
+            atlas.width = imageSize;   // Atlas bitmap width
+            atlas.height = imageSize;  // Atlas bitmap height
+        }
 #endif
+        // Grow atlas (keeping POT) until all glyph rows fit,
+        // size estimation does not consider space wasted at the end of rows
+        while (atlas.width < (maxGlyphWidth + 2*padding + 1)) atlas.width *= 2;
 
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    atlas.mipmaps = 1;
+        bool fits = false;
 
-    // DEBUG: We can see padding in the generated image setting a gray background...
-    //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
+        while (!fits)
+        {
+            int offsetX = padding;
+            int offsetY = padding;
+            fits = true;
+
+            for (int i = 0; i < glyphCount; i++)
+            {
+                if (offsetX >= (atlas.width - glyphs[i].image.width - 2*padding))
+                {
+                    offsetX = padding;
+                    offsetY += (fontSize + 2*padding);
+
+                    if (offsetY > (atlas.height - fontSize - padding)) { fits = false; break; }
+                }
+
+                offsetX += (glyphs[i].image.width + 2*padding);
+            }
+
+            if (!fits)
+            {
+                if (atlas.height < atlas.width) atlas.height *= 2;
+                else atlas.width *= 2;
+            }
+        }
+
+        atlas.data = (unsigned char *)RL_CALLOC(bpp, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp or 24 bpp)
+
+        // DEBUG: We can see padding in the generated image setting a gray background...
+        //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
 
-    if (packMethod == 0)   // Use basic packing algorithm
-    {
         int offsetX = padding;
         int offsetY = padding;
 
@@ -824,29 +1319,13 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
                 // use an internal padding of 4 pixels, it means char rectangle
                 // height is bigger than fontSize, it could be up to (fontSize + 8)
                 offsetY += (fontSize + 2*padding);
-
-                if (offsetY > (atlas.height - fontSize - padding))
-                {
-                    for (int j = i + 1; j < glyphCount; j++)
-                    {
-                        TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", j);
-                        // Make sure remaining recs contain valid data
-                        recs[j].x = 0;
-                        recs[j].y = 0;
-                        recs[j].width = 0;
-                        recs[j].height = 0;
-                    }
-                    break;
-                }
             }
 
             // Copy pixel data from glyph image to atlas
             for (int y = 0; y < glyphs[i].image.height; y++)
             {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                }
+                memcpy((unsigned char *)atlas.data + ((offsetY + y)*atlas.width + offsetX)*bpp,
+                    (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width*bpp, glyphs[i].image.width*bpp);
             }
 
             // Fill chars rectangles in atlas info
@@ -859,77 +1338,221 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             offsetX += (glyphs[i].image.width + 2*padding);
         }
     }
-    else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
+    else    // Use Skyline rect packing algorithm (stb_pack_rect)
     {
-        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
-
-        stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
-        stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+        // Find glyphs sharing the same bitmap, only one copy is packed
+        // NOTE: Empty glyphs (i.e. space) share a single blank region, sized to fit all of them
+        int *glyphSource = (int *)RL_MALLOC(glyphCount*sizeof(int));   // Glyph packed with same bitmap, -1 for empty glyphs
+        unsigned int *glyphHash = (unsigned int *)RL_MALLOC(glyphCount*sizeof(unsigned int));
+        int hashCapacity = 64;
+        while (hashCapacity < 2*glyphCount) hashCapacity *= 2;
+        int *hashTable = (int *)RL_MALLOC(hashCapacity*sizeof(int));
+        for (int i = 0; i < hashCapacity; i++) hashTable[i] = -1;
+
+        int emptyWidth = 0;
+        int emptyHeight = 0;
+        int uniqueCount = 0;
 
-        // Fill rectangles for packaging
         for (int i = 0; i < glyphCount; i++)
         {
-            rects[i].id = i;
-            rects[i].w = glyphs[i].image.width + 2*padding;
-            rects[i].h = glyphs[i].image.height + 2*padding;
-        }
+            const unsigned char *pixels = (const unsigned char *)glyphs[i].image.data;
+            int size = glyphs[i].image.width*glyphs[i].image.height*bpp;
+            bool empty = true;
+
+            // FNV-1a hash of glyph bitmap (size included)
+            unsigned int hash = 2166136261u ^ (unsigned int)glyphs[i].image.width;
+            hash = (hash*16777619u) ^ (unsigned int)glyphs[i].image.height;
+            for (int p = 0; p < size; p++)
+            {
+                hash = (hash ^ pixels[p])*16777619u;
+                if (pixels[p] != 0) empty = false;
+            }
+            glyphHash[i] = hash;
 
-        // Package rectangles into atlas
-        stbrp_pack_rects(context, rects, glyphCount);
+            if (empty)
+            {
+                glyphSource[i] = -1;
+                if (glyphs[i].image.width > emptyWidth) emptyWidth = glyphs[i].image.width;
+                if (glyphs[i].image.height > emptyHeight) emptyHeight = glyphs[i].image.height;
+                continue;
+            }
 
-        for (int i = 0; i < glyphCount; i++)
-        {
-            // It returns char rectangles in atlas
-            recs[i].x = rects[i].x + (float)padding;
-            recs[i].y = rects[i].y + (float)padding;
-            recs[i].width = (float)glyphs[i].image.width;
-            recs[i].height = (float)glyphs[i].image.height;
+            glyphSource[i] = i;
 
-            if (rects[i].was_packed)
+            unsigned int slot = hash & (hashCapacity - 1);
+            while (hashTable[slot] != -1)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
+                int j = hashTable[slot];
+
+                if ((glyphHash[j] == hash) && (glyphs[j].image.width == glyphs[i].image.width) &&
+                    (glyphs[j].image.height == glyphs[i].image.height) && (memcmp(glyphs[j].image.data, pixels, size) == 0))
                 {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                    }
+                    glyphSource[i] = j;
+                    break;
                 }
+
+                slot = (slot + 1) & (hashCapacity - 1);
+            }
+
+            if (glyphSource[i] == i)
+            {
+                hashTable[slot] = i;
+                uniqueCount++;
             }
-            else TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
         }
 
-        RL_FREE(rects);
-        RL_FREE(nodes);
-        RL_FREE(context);
-    }
+        // Fill rectangles for packaging, unique bitmaps and blank region (last one)
+        stbrp_rect *rects = (stbrp_rect *)RL_CALLOC(uniqueCount + 1, sizeof(stbrp_rect));
+        int rectCount = 0;
+        int totalArea = 0;
+        int totalHeight = 0;
+        int maxWidth = 0;
+        int glyphsArea = 0;
 
-#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        for (int i = 0; i <= glyphCount; i++)
+        {
+            int width = 0;
+            int height = 0;
+
+            if (i < glyphCount)
+            {
+                if (glyphSource[i] != i) continue;
+                width = glyphs[i].image.width;
+                height = glyphs[i].image.height;
+            }
+            else
+            {
+                width = emptyWidth;
+                height = emptyHeight;
+            }
+
+            rects[rectCount].id = i;
+            rects[rectCount].w = width + 2*padding;
+            rects[rectCount].h = height + 2*padding;
+
+            totalArea += rects[rectCount].w*rects[rectCount].h;
+            totalHeight += rects[rectCount].h;
+            if (rects[rectCount].w > maxWidth) maxWidth = rects[rectCount].w;
+            if (i < glyphCount) glyphsArea += width*height;
+
+            rectCount++;
+        }
+
+        // Try some atlas widths around the squared size, atlas height is adjusted to the packed rectangles
+        // NOTE: Atlas is packed into an unbounded height, so packing can not fail, atlas grows as required
+        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
+        int *rectsX = (int *)RL_MALLOC(rectCount*sizeof(int));
+        int *rectsY = (int *)RL_MALLOC(rectCount*sizeof(int));
+        int squareSize = (int)ceilf(sqrtf((float)totalArea));
+
+        for (int k = 0; k < 6; k++)
+        {
+            int width = (int)((float)squareSize*(1.0f + 0.1f*k));
+            if (width < maxWidth) width = maxWidth;
+            if (width < 4) width = 4;   // Minimum size, avoids zero sized atlas for empty glyphs
+            width = (width + 3) & ~3;   // Keep a multiple of 4 for rows alignment
+
+            stbrp_node *nodes = (stbrp_node *)RL_MALLOC(width*sizeof(*nodes));
+            stbrp_init_target(context, width, totalHeight, nodes, width);
+            stbrp_setup_heuristic(context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+            stbrp_pack_rects(context, rects, rectCount);
+            RL_FREE(nodes);
+
+            int height = 0;
+            for (int r = 0; r < rectCount; r++) if ((rects[r].y + rects[r].h) > height) height = rects[r].y + rects[r].h;
+
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+            // Make sure white rectangle at the bottom-right corner does not overlap any glyph
+            for (int r = 0; r < rectCount; r++)
+            {
+                if (((rects[r].x + rects[r].w) > (width - 3)) && ((rects[r].y + rects[r].h) > (height - 3))) { height += 3; break; }
+            }
+#endif
+            height = (height + 3) & ~3;
+            if (height < 4) height = 4;
+
+            if ((k == 0) || ((width*height) < (atlas.width*atlas.height)))
+            {
+                atlas.width = width;
+                atlas.height = height;
+                for (int r = 0; r < rectCount; r++) { rectsX[r] = rects[r].x; rectsY[r] = rects[r].y; }
+            }
+        }
+
+        atlas.data = (unsigned char *)RL_CALLOC(bpp, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp or 24 bpp)
+
+        // Copy unique glyphs pixel data into atlas
+        int blankX = 0;
+        int blankY = 0;
+
+        for (int r = 0; r < rectCount; r++)
+        {
+            int i = rects[r].id;
+
+            if (i == glyphCount)
+            {
+                blankX = rectsX[r] + padding;
+                blankY = rectsY[r] + padding;
+                continue;
+            }
+
+            for (int y = 0; y < glyphs[i].image.height; y++)
+            {
+                memcpy((unsigned char *)atlas.data + ((rectsY[r] + padding + y)*atlas.width + rectsX[r] + padding)*bpp,
+                    (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width*bpp, glyphs[i].image.width*bpp);
+            }
+
+            recs[i] = (Rectangle){ (float)(rectsX[r] + padding), (float)(rectsY[r] + padding), (float)glyphs[i].image.width, (float)glyphs[i].image.height };
+        }
+
+        // Fill chars rectangles in atlas info, duplicated and empty glyphs
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (glyphSource[i] == -1) recs[i] = (Rectangle){ (float)blankX, (float)blankY, (float)glyphs[i].image.width, (float)glyphs[i].image.height };
+            else if (glyphSource[i] != i) recs[i] = recs[glyphSource[i]];
+        }
+
+        TRACELOG(LOG_INFO, "FONT: Atlas packed (%ix%i | %i glyphs, %i unique | %.1f%% pixels density)",
+            atlas.width, atlas.height, glyphCount, uniqueCount, 100.0f*(float)glyphsArea/(float)(atlas.width*atlas.height));
+
+        RL_FREE(rectsX);
+        RL_FREE(rectsY);
+        RL_FREE(context);
+        RL_FREE(rects);
+        RL_FREE(hashTable);
+        RL_FREE(glyphHash);
+        RL_FREE(glyphSource);
+    }
+
+    atlas.format = (bpp == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    atlas.mipmaps = 1;
+
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
     // useful to use as the white texture to draw shapes with raylib, using this rectangle
     // shapes and text can be backed into a single draw call: SetShapesTexture()
     for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
     {
-        ((unsigned char *)atlas.data)[k - 0] = 255;
-        ((unsigned char *)atlas.data)[k - 1] = 255;
-        ((unsigned char *)atlas.data)[k - 2] = 255;
+        memset((unsigned char *)atlas.data + (k - 2)*bpp, 255, 3*bpp);
         k -= atlas.width;
     }
 #endif
 
-    // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    if (bpp == 1)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        // Convert image data from GRAYSCALE to GRAY_ALPHA
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
+
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *glyphRecs = recs;
 
@@ -951,17 +1574,86 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
-    // NOTE: Make sure font is not default font (fallback)
-    if (font.texture.id != GetFontDefault().texture.id)
+    // NOTE: Make sure font is not default font (fallback), checked by glyphs data,
+    // texture id is 0 for all fonts when no GPU is available
+    if (font.glyphs != GetFontDefault().glyphs)
     {
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.lookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
+// Export font as binary font file, returns true on success
+// NOTE: Binary font files load with no glyphs rasterization or atlas packing [LoadFontBinary()]
+bool ExportFontBinary(Font font, const char *fileName)
+{
+    if (!IsFontValid(font)) return false;
+
+    rGlyphLookup *lookup = font.lookup;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((lookup != NULL) && (lookup->dynamic != NULL))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic fonts can not be exported as binary font", fileName);
+        return false;
+    }
+#endif
+
+    // Get font atlas, from GPU texture or composed from glyphs images
+    Image atlas = { 0 };
+    if (isGpuReady && (font.texture.id > 0)) atlas = LoadImageFromTexture(font.texture);
+
+    if (atlas.data == NULL)
+    {
+        int width = font.texture.width;
+        int height = font.texture.height;
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if ((int)(font.recs[i].x + font.recs[i].width) > width) width = (int)(font.recs[i].x + font.recs[i].width);
+            if ((int)(font.recs[i].y + font.recs[i].height) > height) height = (int)(font.recs[i].y + font.recs[i].height);
+        }
+
+        // NOTE: MSDF fonts glyphs are RGB, other fonts glyphs are stored as GRAY_ALPHA
+        int format = ((lookup != NULL) && (lookup->type == FONT_MSDF))? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        int bpp = (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : 2;
+
+        atlas = GenImageColor(width, height, BLANK);
+        ImageFormat(&atlas, format);
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].image.data == NULL) continue;
+
+            Image glyph = ImageCopy(font.glyphs[i].image);
+            ImageFormat(&glyph, format);
+
+            int rows = (glyph.height < (int)font.recs[i].height)? glyph.height : (int)font.recs[i].height;
+            int columns = (glyph.width < (int)font.recs[i].width)? glyph.width : (int)font.recs[i].width;
+
+            for (int y = 0; y < rows; y++)
+            {
+                memcpy((unsigned char *)atlas.data + (((int)font.recs[i].y + y)*atlas.width + (int)font.recs[i].x)*bpp,
+                    (unsigned char *)glyph.data + y*glyph.width*bpp, columns*bpp);
+            }
+
+            UnloadImage(glyph);
+        }
+    }
+
+    bool success = SaveFontBinary(font, atlas, (lookup != NULL)? lookup->type : FONT_DEFAULT, fileName);
+
+    UnloadImage(atlas);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font binary file exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font binary file", fileName);
+
+    return success;
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -1155,16 +1847,40 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
+    bool sdfShader = BeginTextShaderSDF(font);
+
+    DrawTextBytes(font, text, size, position, fontSize, spacing, tint);
+
+    if (sdfShader) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+}
+
+// Draw text bytes using font and additional parameters
+static void DrawTextBytes(Font font, const char *text, int size, Vector2 position, float fontSize, float spacing, Color tint)
+{
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previous = 0;               // Previous codepoint for kerning, 0 after spaces and line breaks
+
+    // Glyphs are gathered and their quads emitted together
+    int glyphIndices[MAX_TEXT_GLYPHS_BATCH] = { 0 };
+    Vector2 glyphPositions[MAX_TEXT_GLYPHS_BATCH] = { 0 };
+    int glyphCount = 0;
 
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
         int codepointByteCount = 0;
         int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+
+        // NOTE: Dynamic fonts could evict pending glyphs rasterizing a new one, pending glyphs are drawn first
+        if ((glyphCount > 0) && IsGlyphLoadRequired(font, codepoint))
+        {
+            DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
+            glyphCount = 0;
+        }
+
         int index = GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
@@ -1172,13 +1888,26 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previous = 0;
         }
         else
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                textOffsetX += GetLookupKerning(font.lookup, previous, codepoint)*scaleFactor;
+                previous = codepoint;
+
+                glyphIndices[glyphCount] = index;
+                glyphPositions[glyphCount] = (Vector2){ position.x + textOffsetX, position.y + textOffsetY };
+                glyphCount++;
+
+                if (glyphCount == MAX_TEXT_GLYPHS_BATCH)
+                {
+                    DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
+                    glyphCount = 0;
+                }
             }
+            else previous = 0;
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
@@ -1186,6 +1915,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1208,22 +1939,12 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
 
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+    bool sdfShader = BeginTextShaderSDF(font);
 
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+    DrawTextGlyphs(font, &index, &position, 1, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
 
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    if (sdfShader) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
 // Draw multiple character (codepoints)
@@ -1233,9 +1954,24 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previous = 0;               // Previous codepoint for kerning, 0 after spaces and line breaks
+
+    // Glyphs are gathered and their quads emitted together
+    int glyphIndices[MAX_TEXT_GLYPHS_BATCH] = { 0 };
+    Vector2 glyphPositions[MAX_TEXT_GLYPHS_BATCH] = { 0 };
+    int glyphCount = 0;
+
+    bool sdfShader = BeginTextShaderSDF(font);
 
     for (int i = 0; i < codepointCount; i++)
     {
+        // NOTE: Dynamic fonts could evict pending glyphs rasterizing a new one, pending glyphs are drawn first
+        if ((glyphCount > 0) && IsGlyphLoadRequired(font, codepoints[i]))
+        {
+            DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
+            glyphCount = 0;
+        }
+
         int index = GetGlyphIndex(font, codepoints[i]);
 
         if (codepoints[i] == '\n')
@@ -1243,18 +1979,35 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previous = 0;
         }
         else
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                textOffsetX += GetLookupKerning(font.lookup, previous, codepoints[i])*scaleFactor;
+                previous = codepoints[i];
+
+                glyphIndices[glyphCount] = index;
+                glyphPositions[glyphCount] = (Vector2){ position.x + textOffsetX, position.y + textOffsetY };
+                glyphCount++;
+
+                if (glyphCount == MAX_TEXT_GLYPHS_BATCH)
+                {
+                    DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
+                    glyphCount = 0;
+                }
             }
+            else previous = 0;
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    DrawTextGlyphs(font, glyphIndices, glyphPositions, glyphCount, (Vector2){ 0.0f, 0.0f }, fontSize, tint);
+
+    if (sdfShader) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1301,6 +2054,7 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
     int letter = 0;                 // Current character
     int index = 0;                  // Index position in sprite font
+    int previous = 0;               // Previous character for kerning, 0 after spaces and line breaks
 
     for (int i = 0; i < size;)
     {
@@ -1314,6 +2068,13 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
         if (letter != '\n')
         {
+            if ((letter != ' ') && (letter != '\t'))
+            {
+                textWidth += GetLookupKerning(font.lookup, previous, letter);
+                previous = letter;
+            }
+            else previous = 0;
+
             if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
             else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
         }
@@ -1322,6 +2083,7 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
             if (tempTextWidth < textWidth) tempTextWidth = textWidth;
             byteCounter = 0;
             textWidth = 0;
+            previous = 0;
 
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textHeight += (fontSize + textLineSpacing);
@@ -1339,12 +2101,34 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 }
 
 // Get index position for a unicode character on font
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
+// NOTE 1: If codepoint is not found in the font it fallbacks to '?'
+// NOTE 2: Fonts loaded by raylib use a lookup table, fonts filled manually fallback to a linear search
 int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
     if (!IsFontValid(font)) return index;
 
+    if (font.lookup != NULL)
+    {
+        rGlyphLookup *lookup = font.lookup;
+        index = GetLookupIndex(lookup, codepoint);
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (lookup->dynamic != NULL)
+        {
+            rFontDynamic *dynamic = lookup->dynamic;
+
+            if (index < 0) index = LoadFontDynamicGlyph(font, codepoint);
+            else if (dynamic->glyphShelf[index] >= 0)
+            {
+                dynamic->useCounter++;
+                dynamic->shelfLastUse[dynamic->glyphShelf[index]] = dynamic->useCounter;
+            }
+        }
+#endif
+        return (index >= 0)? index : lookup->fallbackIndex;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1391,755 +2175,2936 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
+// Get kerning adjustment between two codepoints, in pixels for font base size
+// NOTE: Only fonts loaded from TTF/OTF data contain kerning pairs [SUPPORT_FONT_KERNING]
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    return GetLookupKerning(font.lookup, codepoint, nextCodepoint);
+}
+
 //----------------------------------------------------------------------------------
-// Text strings management functions
+// Text layout functions
 //----------------------------------------------------------------------------------
-// Get text length in bytes, check for \0 character
-unsigned int TextLength(const char *text)
+// Load text layout, glyphs positioned with lines wrapping (wrapWidth > 0) and alignment
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth, int alignment)
 {
-    unsigned int length = 0;
+    TextLayout layout = { 0 };
 
-    if (text != NULL)
-    {
-        // NOTE: Alternative: use strlen(text)
-
-        while (*text++) length++;
-    }
+    UpdateTextLayout(&layout, font, text, fontSize, spacing, wrapWidth, alignment);
 
-    return length;
+    return layout;
 }
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
+// Update text layout, only computed again if text or parameters changed
+// NOTE: Glyphs advance and lines height are the same as DrawTextEx(), words are wrapped at spaces,
+// words longer than wrapping width are broken at any glyph
+void UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth, int alignment)
 {
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
-#endif
+    if (text == NULL) text = "";
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    if ((layout->text != NULL) && (font.texture.id == layout->font.texture.id) && (font.glyphs == layout->font.glyphs) &&
+        (fontSize == layout->fontSize) && (spacing == layout->spacing) && (wrapWidth == layout->wrapWidth) &&
+        (alignment == layout->alignment) && (textLineSpacing == layout->lineSpacing) && (strcmp(text, layout->text) == 0)) return;
 
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
+    int size = TextLength(text);
 
-    va_list args;
-    va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-    va_end(args);
+    RL_FREE(layout->text);
+    layout->text = (char *)RL_MALLOC(size + 1);
+    memcpy(layout->text, text, size + 1);
 
-    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
-    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+    layout->font = font;
+    layout->fontSize = fontSize;
+    layout->spacing = spacing;
+    layout->wrapWidth = wrapWidth;
+    layout->alignment = alignment;
+    layout->lineSpacing = textLineSpacing;
+    layout->glyphCount = 0;
+    layout->size = (Vector2){ 0 };
+
+    // NOTE: Glyphs count is never bigger than text bytes count
+    if (layout->glyphCapacity < size)
     {
-        // Inserting "..." at the end of the string to mark as truncated
-        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-        sprintf(truncBuffer, "...");
+        layout->glyphCapacity = size;
+        layout->codepoints = (int *)RL_REALLOC(layout->codepoints, size*sizeof(int));
+        layout->indices = (int *)RL_REALLOC(layout->indices, size*sizeof(int));
+        layout->positions = (Vector2 *)RL_REALLOC(layout->positions, size*sizeof(Vector2));
     }
 
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+    if (size == 0) return;
 
-    return currentBuffer;
-}
+    float scaleFactor = fontSize/font.baseSize;
+    float lineHeight = fontSize + textLineSpacing;
 
-// Get integer value from text
-// NOTE: This function replaces atoi() [stdlib.h]
-int TextToInteger(const char *text)
-{
-    int value = 0;
-    int sign = 1;
+    int lineCount = 0;
+    int lineCapacity = 16;
+    int *lineStart = (int *)RL_MALLOC(lineCapacity*sizeof(int));      // First glyph of every line
+    float *lineWidth = (float *)RL_MALLOC(lineCapacity*sizeof(float));
 
-    if ((text[0] == '+') || (text[0] == '-'))
+    float offsetX = 0.0f;           // Next glyph position in current line
+    int previous = 0;               // Previous codepoint for kerning, 0 after spaces and line breaks
+    float contentWidth = 0.0f;      // Current line width, trailing spaces not included
+    int breakGlyph = -1;            // First glyph after last space in current line, -1 if none
+    float breakX = 0.0f;            // Position of first glyph after last space in current line
+    float breakWidth = 0.0f;        // Current line width before last space
+
+    lineStart[0] = 0;
+
+    for (int i = 0; i <= size;)
     {
-        if (text[0] == '-') sign = -1;
-        text++;
-    }
+        int codepoint = '\n';       // Text end closes last line
+        int codepointByteCount = 1;
+        if (i < size) codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        i += codepointByteCount;
 
-    for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+        if (codepoint == '\n')
+        {
+            lineWidth[lineCount] = contentWidth;
+            lineCount++;
 
-    return value*sign;
-}
+            if (lineCount == lineCapacity)
+            {
+                lineCapacity *= 2;
+                lineStart = (int *)RL_REALLOC(lineStart, lineCapacity*sizeof(int));
+                lineWidth = (float *)RL_REALLOC(lineWidth, lineCapacity*sizeof(float));
+            }
 
-// Get float value from text
-// NOTE: This function replaces atof() [stdlib.h]
-// WARNING: Only '.' character is understood as decimal point
-float TextToFloat(const char *text)
-{
-    float value = 0.0f;
-    float sign = 1.0f;
+            lineStart[lineCount] = layout->glyphCount;
+            offsetX = 0.0f;
+            contentWidth = 0.0f;
+            breakGlyph = -1;
+            previous = 0;
+            continue;
+        }
 
-    if ((text[0] == '+') || (text[0] == '-'))
-    {
-        if (text[0] == '-') sign = -1.0f;
-        text++;
-    }
+        int index = GetGlyphIndex(font, codepoint);
+        float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-    int i = 0;
-    for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10.0f + (float)(text[i] - '0');
+        if ((codepoint == ' ') || (codepoint == '\t'))
+        {
+            if (contentWidth > 0.0f)
+            {
+                breakGlyph = layout->glyphCount;
+                breakWidth = contentWidth;
+            }
 
-    if (text[i++] == '.')
-    {
-        float divisor = 10.0f;
-        for (; ((text[i] >= '0') && (text[i] <= '9')); i++)
+            offsetX += (advance + spacing);
+            if (breakGlyph == layout->glyphCount) breakX = offsetX;
+            previous = 0;
+            continue;
+        }
+
+        offsetX += GetLookupKerning(font.lookup, previous, codepoint)*scaleFactor;
+        previous = codepoint;
+
+        // Wrap line if glyph does not fit, at last space or at current glyph
+        while ((wrapWidth > 0.0f) && ((offsetX + advance) > wrapWidth) && (layout->glyphCount > lineStart[lineCount]))
         {
-            value += ((float)(text[i] - '0'))/divisor;
-            divisor = divisor*10.0f;
+            int first = (breakGlyph != -1)? breakGlyph : layout->glyphCount;
+            float shiftX = (breakGlyph != -1)? breakX : offsetX;
+
+            lineWidth[lineCount] = (breakGlyph != -1)? breakWidth : contentWidth;
+            lineCount++;
+
+            if (lineCount == lineCapacity)
+            {
+                lineCapacity *= 2;
+                lineStart = (int *)RL_REALLOC(lineStart, lineCapacity*sizeof(int));
+                lineWidth = (float *)RL_REALLOC(lineWidth, lineCapacity*sizeof(float));
+            }
+
+            lineStart[lineCount] = first;
+
+            for (int g = first; g < layout->glyphCount; g++)
+            {
+                layout->positions[g].x -= shiftX;
+                layout->positions[g].y += lineHeight;
+            }
+
+            offsetX -= shiftX;
+            contentWidth = (layout->glyphCount > first)? contentWidth - shiftX : 0.0f;
+            breakGlyph = -1;
         }
-    }
 
-    return value*sign;
-}
+        layout->codepoints[layout->glyphCount] = codepoint;
+        layout->indices[layout->glyphCount] = index;
+        layout->positions[layout->glyphCount] = (Vector2){ offsetX, lineCount*lineHeight };
+        layout->glyphCount++;
 
-#if defined(SUPPORT_TEXT_MANIPULATION)
-// Copy one string to another, returns bytes copied
-int TextCopy(char *dst, const char *src)
-{
-    int bytes = 0;
+        contentWidth = offsetX + advance;
+        offsetX += (advance + spacing);
+    }
 
-    if ((src != NULL) && (dst != NULL))
+    // Layout size and lines alignment
+    for (int l = 0; l < lineCount; l++) if (lineWidth[l] > layout->size.x) layout->size.x = lineWidth[l];
+    layout->size.y = lineCount*lineHeight - textLineSpacing;
+
+    if (alignment != TEXT_ALIGN_LEFT)
     {
-        // NOTE: Alternative: use strcpy(dst, src)
+        float alignWidth = (wrapWidth > 0.0f)? wrapWidth : layout->size.x;
 
-        while (*src != '\0')
+        for (int l = 0; l < lineCount; l++)
         {
-            *dst = *src;
-            dst++;
-            src++;
+            float shiftX = (alignWidth - lineWidth[l])*((alignment == TEXT_ALIGN_CENTER)? 0.5f : 1.0f);
+            int last = (l < (lineCount - 1))? lineStart[l + 1] : layout->glyphCount;
 
-            bytes++;
+            for (int g = lineStart[l]; g < last; g++) layout->positions[g].x += shiftX;
         }
-
-        *dst = '\0';
     }
 
-    return bytes;
+    RL_FREE(lineStart);
+    RL_FREE(lineWidth);
 }
 
-// Check if two text string are equal
-// REQUIRES: strcmp()
-bool TextIsEqual(const char *text1, const char *text2)
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
 {
-    bool result = false;
+    RL_FREE(layout.text);
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.indices);
+    RL_FREE(layout.positions);
+}
 
-    if ((text1 != NULL) && (text2 != NULL))
+// Draw text layout
+// NOTE: Dynamic fonts glyphs could be evicted from atlas, indices are looked up again
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    bool dynamic = false;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    dynamic = ((layout.font.lookup != NULL) && (layout.font.lookup->dynamic != NULL));
+#endif
+
+    bool sdfShader = BeginTextShaderSDF(layout.font);
+
+    if (!dynamic) DrawTextGlyphs(layout.font, layout.indices, layout.positions, layout.glyphCount, position, layout.fontSize, tint);
+    else
     {
-        if (strcmp(text1, text2) == 0) result = true;
+        int glyphIndices[MAX_TEXT_GLYPHS_BATCH] = { 0 };
+        int first = 0;              // First layout glyph of pending glyphs
+        int glyphCount = 0;
+
+        for (int i = 0; i < layout.glyphCount; i++)
+        {
+            // NOTE: Rasterizing a new glyph could evict pending glyphs, pending glyphs are drawn first
+            if ((glyphCount == MAX_TEXT_GLYPHS_BATCH) || ((glyphCount > 0) && IsGlyphLoadRequired(layout.font, layout.codepoints[i])))
+            {
+                DrawTextGlyphs(layout.font, glyphIndices, layout.positions + first, glyphCount, position, layout.fontSize, tint);
+                first = i;
+                glyphCount = 0;
+            }
+
+            glyphIndices[glyphCount] = GetGlyphIndex(layout.font, layout.codepoints[i]);
+            glyphCount++;
+        }
+
+        DrawTextGlyphs(layout.font, glyphIndices, layout.positions + first, glyphCount, position, layout.fontSize, tint);
     }
 
-    return result;
+    if (sdfShader) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
-// Get a piece of a text string
-const char *TextSubtext(const char *text, int position, int length)
+//----------------------------------------------------------------------------------
+// Text view functions
+//----------------------------------------------------------------------------------
+// Load text view, text split in lines, wrapped if wrapWidth > 0
+TextView LoadTextView(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    TextView view = { 0 };
 
-    int textLength = TextLength(text);
+    if (text == NULL) text = "";
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    if (position >= textLength)
-    {
-        position = textLength - 1;
-        length = 0;
-    }
+    rTextViewData *data = (rTextViewData *)RL_CALLOC(1, sizeof(rTextViewData));
+    data->font = font;
+    data->fontSize = fontSize;
+    data->spacing = spacing;
+    data->wrapWidth = wrapWidth;
 
-    if (length >= textLength) length = textLength;
+    // Split text in lines, there is always one line at least
+    int lineCount = 1;
+    for (const char *ptr = text; *ptr != '\0'; ptr++) if (*ptr == '\n') lineCount++;
 
-    // NOTE: Alternative: memcpy(buffer, text + position, length)
+    InsertTextViewLines(data, 0, lineCount);
 
-    for (int c = 0 ; c < length ; c++)
+    const char *lineText = text;
+    for (int i = 0; i < lineCount; i++)
     {
-        *(buffer + c) = *(text + position);
-        text++;
+        int length = 0;
+        while ((lineText[length] != '\0') && (lineText[length] != '\n')) length++;
+
+        ReplaceTextViewLineText(&data->lines[i], 0, 0, lineText, length);
+        WrapTextViewLine(data, &data->lines[i]);
+
+        lineText += (length + 1);
     }
 
-    *(buffer + length) = '\0';
+    BuildTextViewRows(data);
 
-    return buffer;
+    view.data = data;
+
+    return view;
 }
 
-// Replace text string
-// REQUIRES: strlen(), strstr(), strncpy(), strcpy()
-// WARNING: Allocated memory must be manually freed
-char *TextReplace(const char *text, const char *replace, const char *by)
+// Unload text view data
+void UnloadTextView(TextView view)
 {
-    // Sanity checks and initialization
-    if (!text || !replace || !by) return NULL;
+    if (view.data == NULL) return;
 
-    char *result = NULL;
+    for (int i = 0; i < view.data->lineCount; i++)
+    {
+        RL_FREE(view.data->lines[i].text);
+        RL_FREE(view.data->lines[i].rowStart);
+    }
 
-    char *insertPoint = NULL;   // Next insert point
-    char *temp = NULL;          // Temp pointer
-    int replaceLen = 0;         // Replace string length of (the string to remove)
-    int byLen = 0;              // Replacement length (the string to replace by)
-    int lastReplacePos = 0;     // Distance between replace and end of last replace
-    int count = 0;              // Number of replacements
+    RL_FREE(view.data->lines);
+    RL_FREE(view.data->rowIndex);
+    RL_FREE(view.data);
+}
 
-    replaceLen = TextLength(replace);
-    if (replaceLen == 0) return NULL;  // Empty replace causes infinite loop during count
+// Set text view layout parameters, lines only wrapped again if changed
+void SetTextViewLayout(TextView view, Font font, float fontSize, float spacing, float wrapWidth)
+{
+    rTextViewData *data = view.data;
+    if (data == NULL) return;
 
-    byLen = TextLength(by);
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    // Count the number of replacements needed
-    insertPoint = (char *)text;
-    for (count = 0; (temp = strstr(insertPoint, replace)); count++) insertPoint = temp + replaceLen;
+    if ((font.texture.id == data->font.texture.id) && (font.glyphs == data->font.glyphs) &&
+        (fontSize == data->fontSize) && (spacing == data->spacing) && (wrapWidth == data->wrapWidth)) return;
 
-    // Allocate returning string and point temp to it
-    temp = result = (char *)RL_MALLOC(TextLength(text) + (byLen - replaceLen)*count + 1);
+    bool rewrap = (wrapWidth > 0.0f) || (data->wrapWidth > 0.0f);
 
-    if (!result) return NULL;   // Memory could not be allocated
+    data->font = font;
+    data->fontSize = fontSize;
+    data->spacing = spacing;
+    data->wrapWidth = wrapWidth;
 
-    // First time through the loop, all the variable are set correctly from here on,
-    //  - 'temp' points to the end of the result string
-    //  - 'insertPoint' points to the next occurrence of replace in text
-    //  - 'text' points to the remainder of text after "end of replace"
-    while (count--)
+    if (rewrap)
     {
-        insertPoint = strstr(text, replace);
-        lastReplacePos = (int)(insertPoint - text);
-        temp = strncpy(temp, text, lastReplacePos) + lastReplacePos;
-        temp = strcpy(temp, by) + byLen;
-        text += lastReplacePos + replaceLen; // Move to next "end of replace"
+        for (int i = 0; i < data->lineCount; i++) WrapTextViewLine(data, &data->lines[i]);
+        BuildTextViewRows(data);
     }
-
-    // Copy remaind text part after replacement to result (pointed by moving temp)
-    strcpy(temp, text);
-
-    return result;
 }
 
-// Insert text in a specific position, moves all text forward
-// WARNING: Allocated memory must be manually freed
-char *TextInsert(const char *text, const char *insert, int position)
+// Insert text at line and column (bytes), line breaks allowed
+// NOTE: Only edited lines are wrapped again, rows index is rebuilt only if lines are added
+void InsertTextViewText(TextView view, int line, int column, const char *text)
 {
-    int textLen = TextLength(text);
-    int insertLen = TextLength(insert);
+    rTextViewData *data = view.data;
+    if ((data == NULL) || (text == NULL) || (text[0] == '\0')) return;
 
-    char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
+    if (line < 0) line = 0;
+    if (line >= data->lineCount) line = data->lineCount - 1;
+    if (column < 0) column = 0;
+    if (column > data->lines[line].length) column = data->lines[line].length;
 
-    for (int i = 0; i < position; i++) result[i] = text[i];
-    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
-    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+    int breakCount = 0;
+    for (const char *ptr = text; *ptr != '\0'; ptr++) if (*ptr == '\n') breakCount++;
 
-    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+    if (breakCount == 0)
+    {
+        int rowCount = data->lines[line].rowCount;
 
-    return result;
-}
+        ReplaceTextViewLineText(&data->lines[line], column, 0, text, TextLength(text));
+        WrapTextViewLine(data, &data->lines[line]);
 
-// Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
-char *TextJoin(char **textList, int count, const char *delimiter)
-{
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
+        UpdateTextViewRows(data, line, data->lines[line].rowCount - rowCount);
+        return;
+    }
 
-    int totalLength = 0;
-    int delimiterLen = TextLength(delimiter);
+    InsertTextViewLines(data, line + 1, breakCount);
 
-    for (int i = 0; i < count; i++)
-    {
-        int textLength = TextLength(textList[i]);
+    // Line text after column moved to last inserted line
+    TextViewLine *first = &data->lines[line];
+    TextViewLine *last = &data->lines[line + breakCount];
+    int length = 0;
+    while ((text[length] != '\0') && (text[length] != '\n')) length++;
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
-        {
-            memcpy(textPtr, textList[i], textLength);
-            totalLength += textLength;
-            textPtr += textLength;
+    ReplaceTextViewLineText(last, 0, 0, first->text + column, first->length - column);
+    ReplaceTextViewLineText(first, column, first->length - column, text, length);
+    WrapTextViewLine(data, first);
 
-            if ((delimiterLen > 0) && (i < (count - 1)))
-            {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
-            }
-        }
+    for (int i = 1; i <= breakCount; i++)
+    {
+        text += (length + 1);
+        length = 0;
+        while ((text[length] != '\0') && (text[length] != '\n')) length++;
+
+        ReplaceTextViewLineText(&data->lines[line + i], 0, 0, text, length);
+        WrapTextViewLine(data, &data->lines[line + i]);
     }
 
-    return buffer;
+    BuildTextViewRows(data);
 }
 
-// Split string into multiple strings
-// REQUIRES: memset()
-char **TextSplit(const char *text, char delimiter, int *count)
+// Remove text bytes at line and column, line breaks count as one byte
+// NOTE: Only edited line is wrapped again, rows index is rebuilt only if lines are removed
+void RemoveTextViewText(TextView view, int line, int column, int length)
 {
-    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
-    //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
+    rTextViewData *data = view.data;
+    if ((data == NULL) || (length <= 0)) return;
 
-    static char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    if (line < 0) line = 0;
+    if (line >= data->lineCount) line = data->lineCount - 1;
+    if (column < 0) column = 0;
+    if (column > data->lines[line].length) column = data->lines[line].length;
 
-    result[0] = buffer;
-    int counter = 0;
+    // Find removed text end, clamped to text end
+    int endLine = line;
+    int endColumn = column + length;
 
-    if (text != NULL)
+    while ((endColumn > data->lines[endLine].length) && (endLine < (data->lineCount - 1)))
     {
-        counter = 1;
+        endColumn -= (data->lines[endLine].length + 1);
+        endLine++;
+    }
 
-        // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
-        {
-            buffer[i] = text[i];
-            if (buffer[i] == '\0') break;
-            else if (buffer[i] == delimiter)
-            {
-                buffer[i] = '\0';   // Set an end of string at this point
-                result[counter] = buffer + i + 1;
-                counter++;
+    if (endColumn > data->lines[endLine].length) endColumn = data->lines[endLine].length;
 
-                if (counter == MAX_TEXTSPLIT_COUNT) break;
-            }
+    TextViewLine *first = &data->lines[line];
+    int rowCount = first->rowCount;
+
+    if (endLine == line) ReplaceTextViewLineText(first, column, endColumn - column, NULL, 0);
+    else ReplaceTextViewLineText(first, column, first->length - column, data->lines[endLine].text + endColumn, data->lines[endLine].length - endColumn);
+
+    WrapTextViewLine(data, first);
+
+    if (endLine == line) UpdateTextViewRows(data, line, first->rowCount - rowCount);
+    else
+    {
+        for (int i = line + 1; i <= endLine; i++)
+        {
+            RL_FREE(data->lines[i].text);
+            RL_FREE(data->lines[i].rowStart);
         }
+
+        memmove(&data->lines[line + 1], &data->lines[endLine + 1], (data->lineCount - endLine - 1)*sizeof(TextViewLine));
+        data->lineCount -= (endLine - line);
+
+        BuildTextViewRows(data);
     }
+}
 
-    *count = counter;
-    return result;
+// Get text view lines count
+int GetTextViewLineCount(TextView view)
+{
+    return (view.data != NULL)? view.data->lineCount : 0;
 }
 
-// Append text at specific position and move cursor
-// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
-// REQUIRES: strcpy()
-void TextAppend(char *text, const char *append, int *position)
+// Get text view line text (no line break)
+const char *GetTextViewLine(TextView view, int line)
 {
-    strcpy(text + *position, append);
-    *position += TextLength(append);
+    if ((view.data == NULL) || (line < 0) || (line >= view.data->lineCount)) return NULL;
+
+    return view.data->lines[line].text;
 }
 
-// Find first text occurrence within a string
-// REQUIRES: strstr()
-int TextFindIndex(const char *text, const char *find)
+// Get text view content height, all wrapped lines
+float GetTextViewHeight(TextView view)
 {
-    int position = -1;
+    if (view.data == NULL) return 0.0f;
 
-    char *ptr = strstr(text, find);
+    // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+    return view.data->rowCount*(view.data->fontSize + textLineSpacing) - textLineSpacing;
+}
 
-    if (ptr != NULL) position = (int)(ptr - text);
+// Get text view line at vertical offset from content top
+int GetTextViewLineAt(TextView view, float offsetY)
+{
+    if (view.data == NULL) return 0;
 
-    return position;
+    int row = (int)(offsetY/(view.data->fontSize + textLineSpacing));
+    if (row < 0) row = 0;
+    if (row >= view.data->rowCount) row = view.data->rowCount - 1;
+
+    int lineRow = 0;
+
+    return GetTextViewRowLine(view.data, row, &lineRow);
 }
 
-// Get upper case version of provided string
-// WARNING: Limited functionality, only basic characters set
-// TODO: Support UTF-8 diacritics to upper-case, check codepoints
-char *TextToUpper(const char *text)
+// Get text view position of line and column (bytes), relative to content top-left
+Vector2 GetTextViewPosition(TextView view, int line, int column)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    Vector2 position = { 0 };
 
-    if (text != NULL)
+    rTextViewData *data = view.data;
+    if (data == NULL) return position;
+
+    if (line < 0) line = 0;
+    if (line >= data->lineCount) line = data->lineCount - 1;
+    if (column < 0) column = 0;
+    if (column > data->lines[line].length) column = data->lines[line].length;
+
+    TextViewLine *viewLine = &data->lines[line];
+
+    int row = 0;
+    while ((row < (viewLine->rowCount - 1)) && (viewLine->rowStart[row + 1] <= column)) row++;
+
+    float scaleFactor = data->fontSize/data->font.baseSize;
+    int previous = 0;
+
+    for (int i = (row > 0)? viewLine->rowStart[row] : 0; i < column;)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&viewLine->text[i], &codepointByteCount);
+        int index = GetGlyphIndex(data->font, codepoint);
+
+        if ((codepoint != ' ') && (codepoint != '\t'))
         {
-            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
-            else buffer[i] = text[i];
+            position.x += GetLookupKerning(data->font.lookup, previous, codepoint)*scaleFactor;
+            previous = codepoint;
         }
+        else previous = 0;
+
+        if (data->font.glyphs[index].advanceX == 0) position.x += ((float)data->font.recs[index].width*scaleFactor + data->spacing);
+        else position.x += ((float)data->font.glyphs[index].advanceX*scaleFactor + data->spacing);
+
+        i += codepointByteCount;
     }
 
-    return buffer;
+    position.y = (GetTextViewRowsBefore(data, line) + row)*(data->fontSize + textLineSpacing);
+
+    return position;
 }
 
-// Get lower case version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToLower(const char *text)
+// Draw text view lines visible in bounds, scroll is vertical offset from content top
+// NOTE: Only visible rows are processed, rows partially visible are not clipped, use BeginScissorMode() if required
+void DrawTextView(TextView view, Rectangle bounds, float scroll, Color tint)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    rTextViewData *data = view.data;
+    if (data == NULL) return;
 
-    if (text != NULL)
+    float rowHeight = data->fontSize + textLineSpacing;
+
+    int row = (int)(scroll/rowHeight);
+    if (row < 0) row = 0;
+    if (row >= data->rowCount) return;
+
+    float offsetY = bounds.y + row*rowHeight - scroll;
+    int lineRow = 0;
+
+    bool sdfShader = BeginTextShaderSDF(data->font);
+
+    for (int line = GetTextViewRowLine(data, row, &lineRow); (line < data->lineCount) && (offsetY < (bounds.y + bounds.height)); line++, lineRow = 0)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        TextViewLine *viewLine = &data->lines[line];
+
+        for (; (lineRow < viewLine->rowCount) && (offsetY < (bounds.y + bounds.height)); lineRow++)
         {
-            if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
-            else buffer[i] = text[i];
+            int start = (lineRow > 0)? viewLine->rowStart[lineRow] : 0;
+            int end = (lineRow < (viewLine->rowCount - 1))? viewLine->rowStart[lineRow + 1] : viewLine->length;
+
+            DrawTextBytes(data->font, viewLine->text + start, end - start, (Vector2){ bounds.x, offsetY }, data->fontSize, data->spacing, tint);
+
+            offsetY += rowHeight;
         }
     }
 
-    return buffer;
+    if (sdfShader) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
-// Get Pascal case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToPascal(const char *text)
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Get text length in bytes, check for \0 character
+unsigned int TextLength(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    unsigned int length = 0;
 
     if (text != NULL)
     {
-        // Upper case first character
-        if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
-        else buffer[0] = text[0];
+        // NOTE: Alternative: use strlen(text)
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
-        {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
-            {
-                j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
-            }
-        }
+        while (*text++) length++;
     }
 
-    return buffer;
+    return length;
 }
 
-// Get snake case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToSnake(const char *text)
+// Formatting of text with variables to 'embed'
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times (in the same thread),
+// use a TextBuilder for longer strings or strings that must be kept
+const char *TextFormat(const char *text, ...)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+#ifndef MAX_TEXTFORMAT_BUFFERS
+    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
+#endif
 
-    if (text != NULL)
-    {
-        // Check for next separator to upper case another character
-        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
-        {
-            if ((text[j] >= 'A') && (text[j] <= 'Z'))
+    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
+    // NOTE: Buffers are thread local, no need to clear them, vsnprintf() always NULL terminates the string
+    static TEXT_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static TEXT_THREAD_LOCAL int index = 0;
+
+    char *currentBuffer = buffers[index];
+
+    va_list args;
+    va_start(args, text);
+    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
+    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+    {
+        // Inserting "..." at the end of the string to mark as truncated
+        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
+        sprintf(truncBuffer, "...");
+    }
+
+    index += 1;     // Move to next buffer for next function call
+    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+
+    return currentBuffer;
+}
+
+// Get integer value from text
+// NOTE: This function replaces atoi() [stdlib.h]
+int TextToInteger(const char *text)
+{
+    int value = 0;
+    int sign = 1;
+
+    if ((text[0] == '+') || (text[0] == '-'))
+    {
+        if (text[0] == '-') sign = -1;
+        text++;
+    }
+
+    for (int i = 0; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10 + (int)(text[i] - '0');
+
+    return value*sign;
+}
+
+// Get float value from text
+// NOTE: This function replaces atof() [stdlib.h]
+// WARNING: Only '.' character is understood as decimal point
+float TextToFloat(const char *text)
+{
+    float value = 0.0f;
+    float sign = 1.0f;
+
+    if ((text[0] == '+') || (text[0] == '-'))
+    {
+        if (text[0] == '-') sign = -1.0f;
+        text++;
+    }
+
+    int i = 0;
+    for (; ((text[i] >= '0') && (text[i] <= '9')); i++) value = value*10.0f + (float)(text[i] - '0');
+
+    if (text[i++] == '.')
+    {
+        float divisor = 10.0f;
+        for (; ((text[i] >= '0') && (text[i] <= '9')); i++)
+        {
+            value += ((float)(text[i] - '0'))/divisor;
+            divisor = divisor*10.0f;
+        }
+    }
+
+    return value*sign;
+}
+
+#if defined(SUPPORT_TEXT_MANIPULATION)
+// Copy one string to another, returns bytes copied
+int TextCopy(char *dst, const char *src)
+{
+    int bytes = 0;
+
+    if ((src != NULL) && (dst != NULL))
+    {
+        // NOTE: Alternative: use strcpy(dst, src)
+
+        while (*src != '\0')
+        {
+            *dst = *src;
+            dst++;
+            src++;
+
+            bytes++;
+        }
+
+        *dst = '\0';
+    }
+
+    return bytes;
+}
+
+// Check if two text string are equal
+// REQUIRES: strcmp()
+bool TextIsEqual(const char *text1, const char *text2)
+{
+    bool result = false;
+
+    if ((text1 != NULL) && (text2 != NULL))
+    {
+        if (strcmp(text1, text2) == 0) result = true;
+    }
+
+    return result;
+}
+
+// Get a piece of a text string
+const char *TextSubtext(const char *text, int position, int length)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    int textLength = TextLength(text);
+
+    if (position >= textLength)
+    {
+        position = textLength - 1;
+        length = 0;
+    }
+
+    if (length >= textLength) length = textLength;
+
+    // NOTE: Alternative: memcpy(buffer, text + position, length)
+
+    for (int c = 0 ; c < length ; c++)
+    {
+        *(buffer + c) = *(text + position);
+        text++;
+    }
+
+    *(buffer + length) = '\0';
+
+    return buffer;
+}
+
+// Replace text string
+// REQUIRES: strlen(), strstr(), strncpy(), strcpy()
+// WARNING: Allocated memory must be manually freed
+char *TextReplace(const char *text, const char *replace, const char *by)
+{
+    // Sanity checks and initialization
+    if (!text || !replace || !by) return NULL;
+
+    char *result = NULL;
+
+    char *insertPoint = NULL;   // Next insert point
+    char *temp = NULL;          // Temp pointer
+    int replaceLen = 0;         // Replace string length of (the string to remove)
+    int byLen = 0;              // Replacement length (the string to replace by)
+    int lastReplacePos = 0;     // Distance between replace and end of last replace
+    int count = 0;              // Number of replacements
+
+    replaceLen = TextLength(replace);
+    if (replaceLen == 0) return NULL;  // Empty replace causes infinite loop during count
+
+    byLen = TextLength(by);
+
+    // Count the number of replacements needed
+    insertPoint = (char *)text;
+    for (count = 0; (temp = strstr(insertPoint, replace)); count++) insertPoint = temp + replaceLen;
+
+    // Allocate returning string and point temp to it
+    temp = result = (char *)RL_MALLOC(TextLength(text) + (byLen - replaceLen)*count + 1);
+
+    if (!result) return NULL;   // Memory could not be allocated
+
+    // First time through the loop, all the variable are set correctly from here on,
+    //  - 'temp' points to the end of the result string
+    //  - 'insertPoint' points to the next occurrence of replace in text
+    //  - 'text' points to the remainder of text after "end of replace"
+    while (count--)
+    {
+        insertPoint = strstr(text, replace);
+        lastReplacePos = (int)(insertPoint - text);
+        temp = strncpy(temp, text, lastReplacePos) + lastReplacePos;
+        temp = strcpy(temp, by) + byLen;
+        text += lastReplacePos + replaceLen; // Move to next "end of replace"
+    }
+
+    // Copy remaind text part after replacement to result (pointed by moving temp)
+    strcpy(temp, text);
+
+    return result;
+}
+
+// Insert text in a specific position, moves all text forward
+// WARNING: Allocated memory must be manually freed
+char *TextInsert(const char *text, const char *insert, int position)
+{
+    int textLen = TextLength(text);
+    int insertLen = TextLength(insert);
+
+    char *result = (char *)RL_MALLOC(textLen + insertLen + 1);
+
+    for (int i = 0; i < position; i++) result[i] = text[i];
+    for (int i = position; i < insertLen + position; i++) result[i] = insert[i];
+    for (int i = (insertLen + position); i < (textLen + insertLen); i++) result[i] = text[i];
+
+    result[textLen + insertLen] = '\0';     // Make sure text string is valid!
+
+    return result;
+}
+
+// Join text strings with delimiter
+// REQUIRES: memcpy()
+// NOTE: Use TextBuilderJoin() for texts longer than MAX_TEXT_BUFFER_LENGTH
+char *TextJoin(char **textList, int count, const char *delimiter)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    char *textPtr = buffer;
+
+    int totalLength = 0;
+    int delimiterLen = TextLength(delimiter);
+
+    for (int i = 0; i < count; i++)
+    {
+        int textLength = TextLength(textList[i]);
+
+        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
+        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
+        {
+            memcpy(textPtr, textList[i], textLength);
+            totalLength += textLength;
+            textPtr += textLength;
+
+            if ((delimiterLen > 0) && (i < (count - 1)))
+            {
+                memcpy(textPtr, delimiter, delimiterLen);
+                totalLength += delimiterLen;
+                textPtr += delimiterLen;
+            }
+        }
+    }
+
+    *textPtr = '\0';
+
+    return buffer;
+}
+
+// Split string into multiple strings
+// REQUIRES: memset()
+char **TextSplit(const char *text, char delimiter, int *count)
+{
+    // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
+    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
+    // all used memory is static... it has some limitations:
+    //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
+    //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
+
+    static TEXT_THREAD_LOCAL char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    result[0] = buffer;
+    int counter = 0;
+
+    if (text != NULL)
+    {
+        counter = 1;
+
+        // Count how many substrings we have on text and point to every one
+        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        {
+            buffer[i] = text[i];
+            if (buffer[i] == '\0') break;
+            else if (buffer[i] == delimiter)
+            {
+                buffer[i] = '\0';   // Set an end of string at this point
+                result[counter] = buffer + i + 1;
+                counter++;
+
+                if (counter == MAX_TEXTSPLIT_COUNT) break;
+            }
+        }
+    }
+
+    *count = counter;
+    return result;
+}
+
+// Append text at specific position and move cursor
+// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
+// REQUIRES: strcpy()
+void TextAppend(char *text, const char *append, int *position)
+{
+    strcpy(text + *position, append);
+    *position += TextLength(append);
+}
+
+// Find first text occurrence within a string
+// REQUIRES: strstr()
+int TextFindIndex(const char *text, const char *find)
+{
+    int position = -1;
+
+    char *ptr = strstr(text, find);
+
+    if (ptr != NULL) position = (int)(ptr - text);
+
+    return position;
+}
+
+// Get upper case version of provided string
+// WARNING: Limited functionality, only basic characters set
+// TODO: Support UTF-8 diacritics to upper-case, check codepoints
+char *TextToUpper(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if (text != NULL)
+    {
+        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        {
+            if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
+            else buffer[i] = text[i];
+        }
+    }
+
+    return buffer;
+}
+
+// Get lower case version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToLower(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if (text != NULL)
+    {
+        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        {
+            if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
+            else buffer[i] = text[i];
+        }
+    }
+
+    return buffer;
+}
+
+// Get Pascal case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToPascal(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if (text != NULL)
+    {
+        // Upper case first character
+        if ((text[0] >= 'a') && (text[0] <= 'z')) buffer[0] = text[0] - 32;
+        else buffer[0] = text[0];
+
+        // Check for next separator to upper case another character
+        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        {
+            if (text[j] != '_') buffer[i] = text[j];
+            else
+            {
+                j++;
+                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+            }
+        }
+    }
+
+    return buffer;
+}
+
+// Get snake case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToSnake(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if (text != NULL)
+    {
+        // Check for next separator to upper case another character
+        for (int i = 0, j = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        {
+            if ((text[j] >= 'A') && (text[j] <= 'Z'))
+            {
+                if (i >= 1)
+                {
+                    buffer[i] = '_';
+                    i++;
+                }
+                buffer[i] = text[j] + 32;
+            }
+            else buffer[i] = text[j];
+        }
+    }
+
+    return buffer;
+}
+
+// Get Camel case notation version of provided string
+// WARNING: Limited functionality, only basic characters set
+char *TextToCamel(const char *text)
+{
+    static TEXT_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+
+    if (text != NULL)
+    {
+        // Lower case first character
+        if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
+        else buffer[0] = text[0];
+
+        // Check for next separator to upper case another character
+        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        {
+            if (text[j] != '_') buffer[i] = text[j];
+            else
+            {
+                j++;
+                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+            }
+        }
+    }
+
+    return buffer;
+}
+
+// Encode text codepoint into UTF-8 text
+// REQUIRES: memcpy()
+// WARNING: Allocated memory must be manually freed
+char *LoadUTF8(const int *codepoints, int length)
+{
+    // We allocate enough memory to fit all possible codepoints
+    // NOTE: 5 bytes for every codepoint should be enough
+    char *text = (char *)RL_CALLOC(length*5, 1);
+    const char *utf8 = NULL;
+    int size = 0;
+
+    for (int i = 0, bytes = 0; i < length; i++)
+    {
+        utf8 = CodepointToUTF8(codepoints[i], &bytes);
+        memcpy(text + size, utf8, bytes);
+        size += bytes;
+    }
+
+    // Resize memory to text length + string NULL terminator
+    void *ptr = RL_REALLOC(text, size + 1);
+
+    if (ptr != NULL) text = (char *)ptr;
+
+    return text;
+}
+
+// Unload UTF-8 text encoded from codepoints array
+void UnloadUTF8(char *text)
+{
+    RL_FREE(text);
+}
+
+// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
+int *LoadCodepoints(const char *text, int *count)
+{
+    int textLength = TextLength(text);
+
+    int codepointSize = 0;
+    int codepointCount = 0;
+
+    // Allocate a big enough buffer to store as many codepoints as text bytes
+    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+
+    for (int i = 0; i < textLength; codepointCount++)
+    {
+        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
+        i += codepointSize;
+    }
+
+    // Re-allocate buffer to the actual number of codepoints loaded
+    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+
+    *count = codepointCount;
+
+    return codepoints;
+}
+
+// Unload codepoints data from memory
+void UnloadCodepoints(int *codepoints)
+{
+    RL_FREE(codepoints);
+}
+
+// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
+// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
+int GetCodepointCount(const char *text)
+{
+    unsigned int length = 0;
+    char *ptr = (char *)&text[0];
+
+    while (*ptr != '\0')
+    {
+        int next = 0;
+        GetCodepointNext(ptr, &next);
+
+        ptr += next;
+
+        length++;
+    }
+
+    return length;
+}
+
+// Encode codepoint into utf8 text (char array length returned as parameter)
+// NOTE: It uses a static array to store UTF-8 bytes
+const char *CodepointToUTF8(int codepoint, int *utf8Size)
+{
+    static TEXT_THREAD_LOCAL char utf8[6] = { 0 };
+    memset(utf8, 0, 6); // Clear static array
+    int size = 0;       // Byte size of codepoint
+
+    if (codepoint <= 0x7f)
+    {
+        utf8[0] = (char)codepoint;
+        size = 1;
+    }
+    else if (codepoint <= 0x7ff)
+    {
+        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
+        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
+        size = 2;
+    }
+    else if (codepoint <= 0xffff)
+    {
+        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
+        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
+        size = 3;
+    }
+    else if (codepoint <= 0x10ffff)
+    {
+        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
+        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
+        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
+        size = 4;
+    }
+
+    *utf8Size = size;
+
+    return utf8;
+}
+#endif      // SUPPORT_TEXT_MANIPULATION
+
+// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
+// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
+// Total number of bytes processed are returned as a parameter
+// NOTE: The standard says U+FFFD should be returned in case of errors
+// but that character is not supported by the default font in raylib
+int GetCodepoint(const char *text, int *codepointSize)
+{
+/*
+    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+
+    Char. number range  |        UTF-8 octet sequence
+      (hexadecimal)    |              (binary)
+    --------------------+---------------------------------------------
+    0000 0000-0000 007F | 0xxxxxxx
+    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
+    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
+    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+*/
+    // NOTE: on decode errors we return as soon as possible
+
+    int codepoint = 0x3f;   // Codepoint (defaults to '?')
+    int octet = (unsigned char)(text[0]); // The first UTF8 octet
+    *codepointSize = 1;
+
+    if (octet <= 0x7f)
+    {
+        // Only one octet (ASCII range x00-7F)
+        codepoint = text[0];
+    }
+    else if ((octet & 0xe0) == 0xc0)
+    {
+        // Two octets
+
+        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
+        unsigned char octet1 = text[1];
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if ((octet >= 0xc2) && (octet <= 0xdf))
+        {
+            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
+            *codepointSize = 2;
+        }
+    }
+    else if ((octet & 0xf0) == 0xe0)
+    {
+        // Three octets
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+
+        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
+        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
+        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+
+        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
+            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+
+        if ((octet >= 0xe0) && (octet <= 0xef))
+        {
+            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
+            *codepointSize = 3;
+        }
+    }
+    else if ((octet & 0xf8) == 0xf0)
+    {
+        // Four octets
+        if (octet > 0xf4) return codepoint;
+
+        unsigned char octet1 = text[1];
+        unsigned char octet2 = '\0';
+        unsigned char octet3 = '\0';
+
+        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+
+        octet2 = text[2];
+
+        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+
+        octet3 = text[3];
+
+        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+
+        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
+        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+
+        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
+            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+
+        if (octet >= 0xf0)
+        {
+            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
+            *codepointSize = 4;
+        }
+    }
+
+    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+
+    return codepoint;
+}
+
+// Get next codepoint in a byte sequence and bytes processed
+int GetCodepointNext(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    *codepointSize = 1;
+
+    // Get current codepoint and bytes processed
+    if (0xf0 == (0xf8 & ptr[0]))
+    {
+        // 4 byte UTF-8 codepoint
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
+        *codepointSize = 4;
+    }
+    else if (0xe0 == (0xf0 & ptr[0]))
+    {
+        // 3 byte UTF-8 codepoint */
+        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
+        *codepointSize = 3;
+    }
+    else if (0xc0 == (0xe0 & ptr[0]))
+    {
+        // 2 byte UTF-8 codepoint
+        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
+        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
+        *codepointSize = 2;
+    }
+    else if (0x00 == (0x80 & ptr[0]))
+    {
+        // 1 byte UTF-8 codepoint
+        codepoint = ptr[0];
+        *codepointSize = 1;
+    }
+
+    return codepoint;
+}
+
+// Get previous codepoint in a byte sequence and bytes processed
+int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+//----------------------------------------------------------------------------------
+// Text builder functions
+//----------------------------------------------------------------------------------
+// Load text builder on caller buffer, allocated (and growing) if buffer is NULL
+// NOTE: Builders using a caller buffer (stack, arena...) never allocate memory, every builder can be used
+// from a different thread
+TextBuilder LoadTextBuilder(char *buffer, int size)
+{
+    TextBuilder builder = { 0 };
+
+    if (buffer == NULL)
+    {
+        if (size < 16) size = 16;
+
+        buffer = (char *)RL_MALLOC(size);
+        builder.owned = true;
+    }
+    else if (size <= 0) return builder;     // Not valid caller buffer, all text truncated
+
+    builder.text = buffer;
+    builder.capacity = size;
+    builder.text[0] = '\0';
+
+    return builder;
+}
+
+// Unload text builder, caller buffer is not freed
+void UnloadTextBuilder(TextBuilder builder)
+{
+    if (builder.owned) RL_FREE(builder.text);
+}
+
+// Reset text builder to empty text
+void TextBuilderReset(TextBuilder *builder)
+{
+    builder->length = 0;
+    builder->truncated = false;
+    if (builder->capacity > 0) builder->text[0] = '\0';
+}
+
+// Append text to builder
+void TextBuilderAppend(TextBuilder *builder, const char *text)
+{
+    AppendTextBuilderBytes(builder, text, TextLength(text));
+}
+
+// Append formatted text to builder (sprintf() style)
+// NOTE: Text is formatted directly into builder buffer, formatted again only if an allocated buffer must grow
+void TextBuilderAppendFormat(TextBuilder *builder, const char *text, ...)
+{
+    if (builder->capacity == 0)
+    {
+        builder->truncated = true;
+        return;
+    }
+
+    int available = builder->capacity - builder->length;
+
+    va_list args;
+    va_start(args, text);
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int requiredByteCount = vsnprintf(builder->text + builder->length, available, text, args);
+    va_end(args);
+
+    if (requiredByteCount >= available)
+    {
+        if (builder->owned)
+        {
+            builder->capacity = ((builder->length + requiredByteCount + 1) > 2*builder->capacity)? (builder->length + requiredByteCount + 1) : 2*builder->capacity;
+            builder->text = (char *)RL_REALLOC(builder->text, builder->capacity);
+
+            vsnprintf(builder->text + builder->length, requiredByteCount + 1, text, argsCopy);
+            builder->length += requiredByteCount;
+        }
+        else
+        {
+            builder->length = builder->capacity - 1;
+            builder->truncated = true;
+        }
+    }
+    else if (requiredByteCount > 0) builder->length += requiredByteCount;
+    else builder->text[builder->length] = '\0';   // Formatting error, previous text kept
+
+    va_end(argsCopy);
+}
+
+// Append text strings joined with delimiter to builder
+void TextBuilderJoin(TextBuilder *builder, char **textList, int count, const char *delimiter)
+{
+    int delimiterLength = TextLength(delimiter);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (i > 0) AppendTextBuilderBytes(builder, delimiter, delimiterLength);
+        AppendTextBuilderBytes(builder, textList[i], TextLength(textList[i]));
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Load glyphs lookup table (codepoint to glyph index)
+// NOTE: First glyph wins for duplicated codepoints, same as linear search
+static rGlyphLookup *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+
+    int highCount = 0;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63) lookup->fallbackIndex = i;   // Fallback glyph '?' (last one found)
+        if ((glyphs[i].value < 0) || (glyphs[i].value > 0xffff)) highCount++;
+    }
+
+    if (highCount > 0)
+    {
+        lookup->hashCapacity = 16;
+        while (lookup->hashCapacity < 2*highCount) lookup->hashCapacity *= 2;
+
+        lookup->hashCodepoints = (int *)RL_MALLOC(lookup->hashCapacity*sizeof(int));
+        lookup->hashIndices = (int *)RL_MALLOC(lookup->hashCapacity*sizeof(int));
+        for (int i = 0; i < lookup->hashCapacity; i++) lookup->hashCodepoints[i] = -1;
+    }
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+
+        if ((codepoint >= 0) && (codepoint <= 0xffff))
+        {
+            int *page = lookup->pages[codepoint >> 8];
+
+            if (page == NULL)
+            {
+                page = (int *)RL_MALLOC(256*sizeof(int));
+                for (int j = 0; j < 256; j++) page[j] = -1;
+                lookup->pages[codepoint >> 8] = page;
+            }
+
+            if (page[codepoint & 0xff] == -1) page[codepoint & 0xff] = i;
+        }
+        else if (codepoint != -1)
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashCapacity - 1);
+            while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & (lookup->hashCapacity - 1);
+
+            if (lookup->hashCodepoints[slot] == -1)
+            {
+                lookup->hashCodepoints[slot] = codepoint;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    return lookup;
+}
+
+// Unload glyphs lookup table
+static void UnloadGlyphLookup(rGlyphLookup *lookup)
+{
+    if (lookup != NULL)
+    {
+        for (int i = 0; i < 256; i++) RL_FREE(lookup->pages[i]);
+        RL_FREE(lookup->hashCodepoints);
+        RL_FREE(lookup->hashIndices);
+        RL_FREE(lookup->kerningFirst);
+        RL_FREE(lookup->kerningSecond);
+        RL_FREE(lookup->kerningValues);
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (lookup->dynamic != NULL)
+        {
+            RL_FREE(lookup->dynamic->fileData);
+            RL_FREE(lookup->dynamic->shelfOffset);
+            RL_FREE(lookup->dynamic->shelfLastUse);
+            RL_FREE(lookup->dynamic->glyphShelf);
+            RL_FREE(lookup->dynamic);
+        }
+#endif
+        RL_FREE(lookup);
+    }
+}
+
+// Load kerning hash table from pairs (first and second codepoints) and values
+static void LoadKerningTable(rGlyphLookup *lookup, const int *pairs, const float *values, int pairCount)
+{
+    if ((lookup == NULL) || (pairCount <= 0)) return;
+
+    lookup->kerningCapacity = 16;
+    while (lookup->kerningCapacity < 2*pairCount) lookup->kerningCapacity *= 2;
+
+    lookup->kerningFirst = (int *)RL_MALLOC(lookup->kerningCapacity*sizeof(int));
+    lookup->kerningSecond = (int *)RL_MALLOC(lookup->kerningCapacity*sizeof(int));
+    lookup->kerningValues = (float *)RL_MALLOC(lookup->kerningCapacity*sizeof(float));
+    for (int i = 0; i < lookup->kerningCapacity; i++) lookup->kerningFirst[i] = -1;
+
+    for (int i = 0; i < pairCount; i++)
+    {
+        unsigned int slot = ((unsigned int)pairs[2*i]*2654435761u ^ (unsigned int)pairs[2*i + 1]*40503u) & (lookup->kerningCapacity - 1);
+        while ((lookup->kerningFirst[slot] != -1) && ((lookup->kerningFirst[slot] != pairs[2*i]) || (lookup->kerningSecond[slot] != pairs[2*i + 1]))) slot = (slot + 1) & (lookup->kerningCapacity - 1);
+
+        lookup->kerningFirst[slot] = pairs[2*i];
+        lookup->kerningSecond[slot] = pairs[2*i + 1];
+        lookup->kerningValues[slot] = values[i];
+    }
+}
+
+// Get glyph index from lookup table, -1 if codepoint not in table
+static int GetLookupIndex(const rGlyphLookup *lookup, int codepoint)
+{
+    int index = -1;
+
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        if (lookup->pages[codepoint >> 8] != NULL) index = lookup->pages[codepoint >> 8][codepoint & 0xff];
+    }
+    else if (lookup->hashCapacity > 0)
+    {
+        for (unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashCapacity - 1); lookup->hashCodepoints[slot] != -1; slot = (slot + 1) & (lookup->hashCapacity - 1))
+        {
+            if (lookup->hashCodepoints[slot] == codepoint) { index = lookup->hashIndices[slot]; break; }
+        }
+    }
+
+    return index;
+}
+
+// Check if glyph must be rasterized on lookup, only dynamic fonts glyphs not in atlas
+// NOTE: Rasterizing a glyph could evict other glyphs from atlas, invalidating their indices
+static bool IsGlyphLoadRequired(Font font, int codepoint)
+{
+    return ((font.lookup != NULL) && (font.lookup->dynamic != NULL) && (GetLookupIndex(font.lookup, codepoint) < 0));
+}
+
+// Get kerning for codepoints pair from lookup table
+static float GetLookupKerning(const rGlyphLookup *lookup, int codepoint, int nextCodepoint)
+{
+    if ((lookup == NULL) || (lookup->kerningCapacity == 0) || (codepoint <= 0)) return 0.0f;
+
+    unsigned int slot = ((unsigned int)codepoint*2654435761u ^ (unsigned int)nextCodepoint*40503u) & (lookup->kerningCapacity - 1);
+
+    for (; lookup->kerningFirst[slot] != -1; slot = (slot + 1) & (lookup->kerningCapacity - 1))
+    {
+        if ((lookup->kerningFirst[slot] == codepoint) && (lookup->kerningSecond[slot] == nextCodepoint)) return lookup->kerningValues[slot];
+    }
+
+    return 0.0f;
+}
+
+// Draw glyphs quads in bulk, positions relative to origin
+// NOTE: Font texture is set once and render batch space is reserved for many glyphs at once,
+// glyphs indices must be resolved before, dynamic fonts could update texture on lookup,
+// SDF shader is enabled by public drawing functions, once for all glyphs chunks [BeginTextShaderSDF()]
+static void DrawTextGlyphs(Font font, const int *indices, const Vector2 *positions, int count, Vector2 origin, float fontSize, Color tint)
+{
+    if ((count <= 0) || (font.texture.id == 0)) return;
+
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                  // Normal vector pointing towards viewer
+
+        for (int i = 0; i < count; i++)
+        {
+            // Reserve render batch space for next glyphs quads
+            if ((i%MAX_TEXT_GLYPHS_BATCH) == 0) rlCheckRenderBatchLimit(4*(((count - i) < MAX_TEXT_GLYPHS_BATCH)? (count - i) : MAX_TEXT_GLYPHS_BATCH));
+
+            const GlyphInfo *glyph = &font.glyphs[indices[i]];
+            const Rectangle *rec = &font.recs[indices[i]];
+
+            // Character destination rectangle on screen
+            // NOTE: We consider glyphPadding on drawing
+            float x = origin.x + positions[i].x;
+            float y = origin.y + positions[i].y;
+            float dstX = x + glyph->offsetX*scaleFactor - padding*scaleFactor;
+            float dstY = y + glyph->offsetY*scaleFactor - padding*scaleFactor;
+            float dstWidth = (rec->width + 2.0f*padding)*scaleFactor;
+            float dstHeight = (rec->height + 2.0f*padding)*scaleFactor;
+
+            // Character source rectangle from font texture atlas
+            // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+            float srcX = rec->x - padding;
+            float srcY = rec->y - padding;
+            float srcWidth = rec->width + 2.0f*padding;
+            float srcHeight = rec->height + 2.0f*padding;
+
+            rlTexCoord2f(srcX/width, srcY/height);
+            rlVertex2f(dstX, dstY);
+
+            rlTexCoord2f(srcX/width, (srcY + srcHeight)/height);
+            rlVertex2f(dstX, dstY + dstHeight);
+
+            rlTexCoord2f((srcX + srcWidth)/width, (srcY + srcHeight)/height);
+            rlVertex2f(dstX + dstWidth, dstY + dstHeight);
+
+            rlTexCoord2f((srcX + srcWidth)/width, srcY/height);
+            rlVertex2f(dstX + dstWidth, dstY);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Enable built-in SDF shader for SDF fonts, if no custom shader enabled
+// NOTE 1: Distance is the minimum of RGB median and alpha: SDF atlas is GRAY_ALPHA (white, distance in alpha),
+// MSDF atlas is RGB (opaque), edges are anti-aliased using distance screen derivatives, valid for any size
+// NOTE 2: Returns true only if shader was changed, shader already enabled by an outer drawing call is kept,
+// so nested drawing calls do not switch shaders (every switch draws the pending render batch)
+static bool BeginTextShaderSDF(Font font)
+{
+    bool enabled = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((font.lookup == NULL) || ((font.lookup->type != FONT_SDF) && (font.lookup->type != FONT_MSDF)) ||
+        (rlGetShaderIdCurrent() != rlGetShaderIdDefault())) return false;
+
+    if (textShaderSDF.id == 0)
+    {
+        const char *sdfFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+        "#version 120                       \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying vec4 fragColor;            \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 texel = texture2D(texture0, fragTexCoord); \n"
+        "    float dist = min(max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b)), texel.a); \n"
+        "    float width = 0.7*fwidth(dist); \n"
+        "    float alpha = smoothstep(0.5 - width, 0.5 + width, dist); \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+        "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+        "#version 330                       \n"
+        "in vec2 fragTexCoord;              \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 texel = texture(texture0, fragTexCoord); \n"
+        "    float dist = min(max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b)), texel.a); \n"
+        "    float width = 0.7*fwidth(dist); \n"
+        "    float alpha = smoothstep(0.5 - width, 0.5 + width, dist); \n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+        "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES3)
+        "#version 300 es                    \n"
+        "precision mediump float;           \n"
+        "in vec2 fragTexCoord;              \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 texel = texture(texture0, fragTexCoord); \n"
+        "    float dist = min(max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b)), texel.a); \n"
+        "    float width = 0.7*fwidth(dist); \n"
+        "    float alpha = smoothstep(0.5 - width, 0.5 + width, dist); \n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+        "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100                       \n"
+        "#extension GL_OES_standard_derivatives : enable \n"   // Required for fwidth()
+        "precision mediump float;           \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying vec4 fragColor;            \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 texel = texture2D(texture0, fragTexCoord); \n"
+        "    float dist = min(max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b)), texel.a); \n"
+        "    float width = 0.7*fwidth(dist); \n"
+        "    float alpha = smoothstep(0.5 - width, 0.5 + width, dist); \n"
+        "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+        "}                                  \n";
+#endif
+        // NOTE: In case of failure default shader is returned, SDF fonts are drawn as regular fonts
+        textShaderSDF = LoadShaderFromMemory(NULL, sdfFShaderCode);
+    }
+
+    if (textShaderSDF.id != rlGetShaderIdDefault())
+    {
+        rlSetShader(textShaderSDF.id, textShaderSDF.locs);
+        enabled = true;
+    }
+#endif
+
+    return enabled;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize a batch of glyphs, used by LoadFontData()
+// NOTE: Glyph index is looked up once, codepoint based stb_truetype functions look it up on every call
+static void *LoadFontGlyphs(void *batch)
+{
+    const FontGlyphsBatch *data = (const FontGlyphsBatch *)batch;
+    const stbtt_fontinfo *fontInfo = data->fontInfo;
+    int fontSize = data->fontSize;
+    float scaleFactor = data->scaleFactor;
+
+    for (int i = data->first; i < data->count; i += data->step)
+    {
+        GlyphInfo *glyph = &data->glyphs[i];
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = data->codepoints[i];   // Character value to get info for
+        glyph->value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetGlyphBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetGlyphBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeGlyphBitmap()          -- renders into bitmap you provide
+
+        // Check if a glyph is available in the font
+        // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+        int index = stbtt_FindGlyphIndex(fontInfo, ch);
+
+        if (index > 0)
+        {
+            switch (data->type)
+            {
+                case FONT_DEFAULT:
+                case FONT_BITMAP: glyph->image.data = stbtt_GetGlyphBitmap(fontInfo, scaleFactor, scaleFactor, index, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                case FONT_SDF: if (ch != 32) glyph->image.data = stbtt_GetGlyphSDF(fontInfo, scaleFactor, index, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                case FONT_MSDF: if (ch != 32) glyph->image.data = LoadGlyphMSDF(fontInfo, scaleFactor, index, FONT_SDF_CHAR_PADDING, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                default: break;
+            }
+
+            if (glyph->image.data != NULL)    // Glyph data has been found in the font
+            {
+                stbtt_GetGlyphHMetrics(fontInfo, index, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+                if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+
+                // Load characters images
+                glyph->image.width = chw;
+                glyph->image.height = chh;
+                glyph->image.mipmaps = 1;
+                glyph->image.format = (data->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+                glyph->offsetY += (int)((float)data->ascent*scaleFactor);
+            }
+
+            // NOTE: We create an empty image for space character,
+            // it could be further required for atlas packing
+            if (ch == 32)
+            {
+                stbtt_GetGlyphHMetrics(fontInfo, index, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+                Image imSpace = {
+                    .data = RL_CALLOC(glyph->advanceX*fontSize, (data->type == FONT_MSDF)? 3 : 2),
+                    .width = glyph->advanceX,
+                    .height = fontSize,
+                    .mipmaps = 1,
+                    .format = (data->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                glyph->image = imSpace;
+            }
+
+            if (data->type == FONT_BITMAP)
+            {
+                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+                // NOTE: For optimum results, bitmap font should be generated at base pixel size
+                for (int p = 0; p < chw*chh; p++)
+                {
+                    if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+                    else ((unsigned char *)glyph->image.data)[p] = 255;
+                }
+            }
+        }
+        else
+        {
+            // TODO: Use some fallback glyph for codepoints not found in the font
+        }
+    }
+
+    return NULL;
+}
+
+// Generate glyph multi-channel signed distance field (RGB image), distance is the median of channels
+// NOTE 1: Outline edges get two of three channels, channels switch on corners (edges coloring), so every
+// channel distance is rounded on corners but the channels median keeps them sharp when scaled
+// NOTE 2: Same distance mapping as single channel SDF: FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE
+// NOTE 3: Based on msdfgen by Viktor Chlumsky, simplified edges coloring and error correction
+static unsigned char *LoadGlyphMSDF(const stbtt_fontinfo *fontInfo, float scaleFactor, int index, int padding, int *width, int *height, int *offsetX, int *offsetY)
+{
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetGlyphShape(fontInfo, index, &vertices);
+
+    if (vertexCount <= 0) return NULL;
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphBitmapBox(fontInfo, index, scaleFactor, scaleFactor, &x0, &y0, &x1, &y1);
+
+    int w = x1 - x0 + 2*padding;
+    int h = y1 - y0 + 2*padding;
+    *width = w;
+    *height = h;
+    *offsetX = x0 - padding;
+    *offsetY = y0 - padding;
+
+    // Load outline edges in image pixels (Y down), contours start on move vertices
+    GlyphEdge *edges = (GlyphEdge *)RL_CALLOC(vertexCount, sizeof(GlyphEdge));
+    int *contourStart = (int *)RL_CALLOC(vertexCount + 1, sizeof(int));
+    bool *corners = (bool *)RL_CALLOC(vertexCount, sizeof(bool));
+    int edgeCount = 0;
+    int contourCount = 0;
+    Vector2 last = { 0 };
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const stbtt_vertex *vertex = &vertices[i];
+        Vector2 point = { vertex->x*scaleFactor - *offsetX, -vertex->y*scaleFactor - *offsetY };
+
+        if ((vertex->type == STBTT_vmove) || (contourCount == 0))
+        {
+            contourStart[contourCount] = edgeCount;
+            contourCount++;
+            last = point;
+            if (vertex->type == STBTT_vmove) continue;
+        }
+
+        GlyphEdge *edge = &edges[edgeCount];
+        edge->points[0] = last;
+
+        if (vertex->type == STBTT_vcurve)
+        {
+            edge->degree = 2;
+            edge->points[1] = (Vector2){ vertex->cx*scaleFactor - *offsetX, -vertex->cy*scaleFactor - *offsetY };
+        }
+        else if (vertex->type == STBTT_vcubic)
+        {
+            edge->degree = 3;
+            edge->points[1] = (Vector2){ vertex->cx*scaleFactor - *offsetX, -vertex->cy*scaleFactor - *offsetY };
+            edge->points[2] = (Vector2){ vertex->cx1*scaleFactor - *offsetX, -vertex->cy1*scaleFactor - *offsetY };
+        }
+        else edge->degree = 1;
+
+        edge->points[edge->degree] = point;
+        last = point;
+
+        // Skip degenerate edges (all control points equal)
+        bool degenerate = true;
+        float minX = edge->points[0].x, minY = edge->points[0].y, maxX = minX, maxY = minY;
+
+        for (int k = 1; k <= edge->degree; k++)
+        {
+            if ((edge->points[k].x != edge->points[0].x) || (edge->points[k].y != edge->points[0].y)) degenerate = false;
+            minX = fminf(minX, edge->points[k].x);
+            minY = fminf(minY, edge->points[k].y);
+            maxX = fmaxf(maxX, edge->points[k].x);
+            maxY = fmaxf(maxY, edge->points[k].y);
+        }
+
+        if (degenerate) continue;
+
+        edge->bounds = (Rectangle){ minX, minY, maxX - minX, maxY - minY };
+        edgeCount++;
+    }
+
+    contourStart[contourCount] = edgeCount;
+    stbtt_FreeShape(fontInfo, vertices);
+
+    // Edges coloring, contours are split into splines at corners, adjacent splines share only one channel
+    // NOTE: Channels masks: 7-White, 6-Cyan, 5-Magenta, 3-Yellow
+    float area = 0.0f;
+
+    for (int c = 0; c < contourCount; c++)
+    {
+        int first = contourStart[c];
+        int count = contourStart[c + 1] - first;
+        int cornerCount = 0;
+        int firstCorner = 0;
+
+        for (int e = 0; e < count; e++)
+        {
+            Vector2 a = GetGlyphEdgeDirection(&edges[first + (e + count - 1)%count], 1.0f);
+            Vector2 b = GetGlyphEdgeDirection(&edges[first + e], 0.0f);
+            float lengths = sqrtf((a.x*a.x + a.y*a.y)*(b.x*b.x + b.y*b.y));
+
+            // Corner if direction changes more than ~172 degrees: sin(3 rad) = 0.1411
+            corners[e] = (lengths > 0.0f) && (((a.x*b.x + a.y*b.y) <= 0.0f) || (fabsf(a.x*b.y - a.y*b.x) > 0.1411f*lengths));
+
+            if (corners[e])
+            {
+                if (cornerCount == 0) firstCorner = e;
+                cornerCount++;
+            }
+
+            // Contours signed area, using control points polygon, to get outlines orientation
+            for (int k = 0; k < edges[first + e].degree; k++) area += edges[first + e].points[k].x*edges[first + e].points[k + 1].y - edges[first + e].points[k + 1].x*edges[first + e].points[k].y;
+        }
+
+        if (cornerCount == 0)
+        {
+            // Smooth contour, all channels
+            for (int e = 0; e < count; e++) edges[first + e].color = 7;
+        }
+        else if (cornerCount == 1)
+        {
+            // Teardrop contour, edges split in three splines from corner
+            const int colors[3] = { 5, 7, 3 };
+            for (int e = 0; e < count; e++) edges[first + (firstCorner + e)%count].color = (count >= 3)? colors[3*e/count] : 7;
+        }
+        else
+        {
+            const int colors[3] = { 6, 5, 3 };
+            int spline = -1;
+
+            for (int e = 0; e < count; e++)
+            {
+                int k = (firstCorner + e)%count;
+                if (corners[k]) spline++;
+
+                // Last spline must not share color with first one
+                if (((cornerCount%3) == 1) && (spline == (cornerCount - 1))) edges[first + k].color = colors[1];
+                else edges[first + k].color = colors[spline%3];
+            }
+        }
+    }
+
+    // Distances sign, inside positive, depends on outlines orientation (TrueType and CFF are opposite)
+    float orientation = (area > 0.0f)? 1.0f : -1.0f;
+
+    // Compute every channel distance, nearest edge with channel, pseudo-distance from edge ends extended
+    float *distances = (float *)RL_MALLOC(w*h*3*sizeof(float));
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            Vector2 point = { x + 0.5f, y + 0.5f };
+            float minDistance[3] = { 1e30f, 1e30f, 1e30f };
+            float minDot[3] = { 1.0f, 1.0f, 1.0f };
+            float minParam[3] = { 0 };
+            int minEdge[3] = { -1, -1, -1 };
+
+            for (int e = 0; e < edgeCount; e++)
+            {
+                const GlyphEdge *edge = &edges[e];
+
+                // Skip edges farther than current channels distances, bounding box distance is a lower bound
+                float farthest = 0.0f;
+                for (int ch = 0; ch < 3; ch++) if ((edge->color & (1 << ch)) && (fabsf(minDistance[ch]) > farthest)) farthest = fabsf(minDistance[ch]);
+
+                float dx = fmaxf(fmaxf(edge->bounds.x - point.x, point.x - edge->bounds.x - edge->bounds.width), 0.0f);
+                float dy = fmaxf(fmaxf(edge->bounds.y - point.y, point.y - edge->bounds.y - edge->bounds.height), 0.0f);
+                if ((dx*dx + dy*dy) > farthest*farthest) continue;
+
+                float param = 0.0f;
+                float dot = 0.0f;
+                float distance = GetGlyphEdgeDistance(edge, point, &param, &dot);
+
+                // Nearest edge, ties (shared endpoints) solved by most orthogonal edge
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    if (!(edge->color & (1 << ch))) continue;
+
+                    if ((fabsf(distance) < (fabsf(minDistance[ch]) - 1e-5f)) ||
+                        ((fabsf(distance) <= (fabsf(minDistance[ch]) + 1e-5f)) && (dot < minDot[ch])))
+                    {
+                        minDistance[ch] = distance;
+                        minDot[ch] = dot;
+                        minParam[ch] = param;
+                        minEdge[ch] = e;
+                    }
+                }
+            }
+
+            for (int ch = 0; ch < 3; ch++)
             {
-                if (i >= 1)
+                float distance = -1e30f;
+                if (minEdge[ch] >= 0) distance = orientation*GetGlyphEdgePseudoDistance(&edges[minEdge[ch]], point, minDistance[ch], minParam[ch]);
+
+                distances[3*(y*w + x) + ch] = distance;
+            }
+        }
+    }
+
+    // Error correction, texels where channels change more than possible between
+    // neighbors (channels clash) are set to channels median, avoiding interpolation artifacts
+    bool *clashes = (bool *)RL_CALLOC(w*h, sizeof(bool));
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const float *texel = &distances[3*(y*w + x)];
+
+            clashes[y*w + x] = ((x > 0) && IsGlyphMSDFClash(texel, texel - 3, 1.001f)) ||
+                ((x < (w - 1)) && IsGlyphMSDFClash(texel, texel + 3, 1.001f)) ||
+                ((y > 0) && IsGlyphMSDFClash(texel, texel - 3*w, 1.001f)) ||
+                ((y < (h - 1)) && IsGlyphMSDFClash(texel, texel + 3*w, 1.001f));
+        }
+    }
+
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(w*h*3);
+
+    for (int i = 0; i < w*h; i++)
+    {
+        float *texel = &distances[3*i];
+
+        if (clashes[i])
+        {
+            float median = fmaxf(fminf(texel[0], texel[1]), fminf(fmaxf(texel[0], texel[1]), texel[2]));
+            texel[0] = texel[1] = texel[2] = median;
+        }
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            float value = FONT_SDF_ON_EDGE_VALUE + texel[ch]*FONT_SDF_PIXEL_DIST_SCALE;
+            pixels[3*i + ch] = (value <= 0.0f)? 0 : ((value >= 255.0f)? 255 : (unsigned char)(value + 0.5f));
+        }
+    }
+
+    RL_FREE(clashes);
+    RL_FREE(distances);
+    RL_FREE(corners);
+    RL_FREE(contourStart);
+    RL_FREE(edges);
+
+    return pixels;
+}
+
+// Get glyph edge point at parameter t (0..1)
+static Vector2 GetGlyphEdgePoint(const GlyphEdge *edge, float t)
+{
+    const Vector2 *p = edge->points;
+    Vector2 point = { 0 };
+    float s = 1.0f - t;
+
+    switch (edge->degree)
+    {
+        case 1: point = (Vector2){ s*p[0].x + t*p[1].x, s*p[0].y + t*p[1].y }; break;
+        case 2: point = (Vector2){ s*s*p[0].x + 2*s*t*p[1].x + t*t*p[2].x, s*s*p[0].y + 2*s*t*p[1].y + t*t*p[2].y }; break;
+        case 3:
+        {
+            point.x = s*s*s*p[0].x + 3*s*s*t*p[1].x + 3*s*t*t*p[2].x + t*t*t*p[3].x;
+            point.y = s*s*s*p[0].y + 3*s*s*t*p[1].y + 3*s*t*t*p[2].y + t*t*t*p[3].y;
+        } break;
+        default: break;
+    }
+
+    return point;
+}
+
+// Get glyph edge direction (derivative) at parameter t (0..1)
+// NOTE: Control points equal to endpoints give a zero derivative, next control point is used
+static Vector2 GetGlyphEdgeDirection(const GlyphEdge *edge, float t)
+{
+    const Vector2 *p = edge->points;
+    Vector2 direction = { 0 };
+    float s = 1.0f - t;
+
+    switch (edge->degree)
+    {
+        case 1: direction = (Vector2){ p[1].x - p[0].x, p[1].y - p[0].y }; break;
+        case 2:
+        {
+            direction.x = 2*(s*(p[1].x - p[0].x) + t*(p[2].x - p[1].x));
+            direction.y = 2*(s*(p[1].y - p[0].y) + t*(p[2].y - p[1].y));
+            if ((direction.x == 0.0f) && (direction.y == 0.0f)) direction = (Vector2){ p[2].x - p[0].x, p[2].y - p[0].y };
+        } break;
+        case 3:
+        {
+            direction.x = 3*(s*s*(p[1].x - p[0].x) + 2*s*t*(p[2].x - p[1].x) + t*t*(p[3].x - p[2].x));
+            direction.y = 3*(s*s*(p[1].y - p[0].y) + 2*s*t*(p[2].y - p[1].y) + t*t*(p[3].y - p[2].y));
+
+            if ((direction.x == 0.0f) && (direction.y == 0.0f))
+            {
+                if (t < 0.5f) direction = (Vector2){ p[2].x - p[0].x, p[2].y - p[0].y };
+                else direction = (Vector2){ p[3].x - p[1].x, p[3].y - p[1].y };
+
+                if ((direction.x == 0.0f) && (direction.y == 0.0f)) direction = (Vector2){ p[3].x - p[0].x, p[3].y - p[0].y };
+            }
+        } break;
+        default: break;
+    }
+
+    return direction;
+}
+
+// Get signed distance from point to glyph edge, sign from edge side
+// NOTE: Returned param is the nearest point parameter, out of 0..1 if nearest to endpoints (beyond them),
+// dot is the endpoints orthogonality (0 if nearest point is inside edge), used to choose between edges sharing endpoints
+static float GetGlyphEdgeDistance(const GlyphEdge *edge, Vector2 point, float *param, float *dot)
+{
+    const Vector2 *p = edge->points;
+    Vector2 start = p[0];
+    Vector2 end = p[edge->degree];
+
+    // Start with endpoints distances
+    Vector2 direction = GetGlyphEdgeDirection(edge, 0.0f);
+    Vector2 v = { point.x - start.x, point.y - start.y };
+    float minDistance = sqrtf(v.x*v.x + v.y*v.y);
+    if ((direction.x*v.y - direction.y*v.x) < 0.0f) minDistance = -minDistance;
+    float minParam = (v.x*direction.x + v.y*direction.y)/(direction.x*direction.x + direction.y*direction.y);
+
+    direction = GetGlyphEdgeDirection(edge, 1.0f);
+    v = (Vector2){ point.x - end.x, point.y - end.y };
+    float distance = sqrtf(v.x*v.x + v.y*v.y);
+
+    if (distance < fabsf(minDistance))
+    {
+        minDistance = ((direction.x*v.y - direction.y*v.x) < 0.0f)? -distance : distance;
+        minParam = 1.0f + (v.x*direction.x + v.y*direction.y)/(direction.x*direction.x + direction.y*direction.y);
+    }
+
+    // Nearest points inside edge: line projection, quadratic roots (cubic equation) or cubic Newton iterations
+    float candidates[20] = { 0 };
+    int candidateCount = 0;
+
+    if (edge->degree == 1)
+    {
+        // NOTE: Line endpoints parameters are the point projection on line
+        if ((minParam > 0.0f) && (minParam < 1.0f)) candidates[candidateCount++] = minParam;
+    }
+    else if (edge->degree == 2)
+    {
+        Vector2 qa = { p[0].x - point.x, p[0].y - point.y };
+        Vector2 ab = { p[1].x - p[0].x, p[1].y - p[0].y };
+        Vector2 br = { p[2].x - p[1].x - ab.x, p[2].y - p[1].y - ab.y };
+
+        double roots[3] = { 0 };
+        int rootCount = SolveCubic(roots, br.x*br.x + br.y*br.y, 3.0*(ab.x*br.x + ab.y*br.y),
+            2.0*(ab.x*ab.x + ab.y*ab.y) + (qa.x*br.x + qa.y*br.y), qa.x*ab.x + qa.y*ab.y);
+
+        for (int i = 0; i < rootCount; i++) if ((roots[i] > 0.0) && (roots[i] < 1.0)) candidates[candidateCount++] = (float)roots[i];
+    }
+    else
+    {
+        for (int s = 0; s <= 4; s++)
+        {
+            float t = s/4.0f;
+
+            for (int step = 0; step < 4; step++)
+            {
+                Vector2 q = GetGlyphEdgePoint(edge, t);
+                Vector2 qe = { q.x - point.x, q.y - point.y };
+                Vector2 d1 = GetGlyphEdgeDirection(edge, t);
+                Vector2 d2 = {
+                    6*((1.0f - t)*(p[2].x - 2*p[1].x + p[0].x) + t*(p[3].x - 2*p[2].x + p[1].x)),
+                    6*((1.0f - t)*(p[2].y - 2*p[1].y + p[0].y) + t*(p[3].y - 2*p[2].y + p[1].y))
+                };
+
+                float denominator = d1.x*d1.x + d1.y*d1.y + qe.x*d2.x + qe.y*d2.y;
+                if (denominator == 0.0f) break;
+
+                t -= (qe.x*d1.x + qe.y*d1.y)/denominator;
+                if ((t <= 0.0f) || (t >= 1.0f)) break;
+
+                candidates[candidateCount++] = t;
+            }
+        }
+    }
+
+    for (int i = 0; i < candidateCount; i++)
+    {
+        Vector2 q = GetGlyphEdgePoint(edge, candidates[i]);
+        v = (Vector2){ point.x - q.x, point.y - q.y };
+        distance = sqrtf(v.x*v.x + v.y*v.y);
+
+        if (distance <= fabsf(minDistance))
+        {
+            direction = GetGlyphEdgeDirection(edge, candidates[i]);
+            minDistance = ((direction.x*v.y - direction.y*v.x) < 0.0f)? -distance : distance;
+            minParam = candidates[i];
+        }
+    }
+
+    *param = minParam;
+    *dot = 0.0f;
+
+    if ((minParam < 0.0f) || (minParam > 1.0f))
+    {
+        Vector2 endpoint = (minParam < 0.0f)? start : end;
+        direction = GetGlyphEdgeDirection(edge, (minParam < 0.0f)? 0.0f : 1.0f);
+        v = (Vector2){ point.x - endpoint.x, point.y - endpoint.y };
+
+        float lengths = sqrtf((direction.x*direction.x + direction.y*direction.y)*(v.x*v.x + v.y*v.y));
+        if (lengths > 0.0f) *dot = fabsf(direction.x*v.x + direction.y*v.y)/lengths;
+    }
+
+    return minDistance;
+}
+
+// Get pseudo-distance from point to glyph edge, distance to edge ends tangent lines
+// NOTE: Only applies for points beyond edge ends, it keeps corners sharp on channels median
+static float GetGlyphEdgePseudoDistance(const GlyphEdge *edge, Vector2 point, float distance, float param)
+{
+    if ((param >= 0.0f) && (param <= 1.0f)) return distance;
+
+    Vector2 endpoint = (param < 0.0f)? edge->points[0] : edge->points[edge->degree];
+    Vector2 direction = GetGlyphEdgeDirection(edge, (param < 0.0f)? 0.0f : 1.0f);
+    Vector2 v = { point.x - endpoint.x, point.y - endpoint.y };
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+    float along = (v.x*direction.x + v.y*direction.y)/length;
+
+    if (((param < 0.0f) && (along < 0.0f)) || ((param > 1.0f) && (along > 0.0f)))
+    {
+        float pseudoDistance = (direction.x*v.y - direction.y*v.x)/length;
+        if (fabsf(pseudoDistance) <= fabsf(distance)) distance = pseudoDistance;
+    }
+
+    return distance;
+}
+
+// Check if MSDF texels channels clash, two channels changing more than threshold between neighbors
+// NOTE: Only texel farther from edge is flagged, neighbors already equalized are ignored
+static bool IsGlyphMSDFClash(const float *a, const float *b, float threshold)
+{
+    // Sort channels pairs by absolute difference, biggest first
+    float a0 = a[0], a1 = a[1], a2 = a[2];
+    float b0 = b[0], b1 = b[1], b2 = b[2];
+    float temp = 0.0f;
+
+    if (fabsf(b0 - a0) < fabsf(b1 - a1)) { temp = a0; a0 = a1; a1 = temp; temp = b0; b0 = b1; b1 = temp; }
+    if (fabsf(b1 - a1) < fabsf(b2 - a2))
+    {
+        temp = a1; a1 = a2; a2 = temp; temp = b1; b1 = b2; b2 = temp;
+        if (fabsf(b0 - a0) < fabsf(b1 - a1)) { temp = a0; a0 = a1; a1 = temp; temp = b0; b0 = b1; b1 = temp; }
+    }
+
+    return (fabsf(b1 - a1) >= threshold) && !((b0 == b1) && (b0 == b2)) && (fabsf(a2) >= fabsf(b2));
+}
+
+// Solve cubic equation (a*x^3 + b*x^2 + c*x + d = 0) real roots, returns roots count
+// NOTE: Degenerates into quadratic or linear equation for small leading coefficients
+static int SolveCubic(double *roots, double a, double b, double c, double d)
+{
+    if ((a != 0.0) && (fabs(b/a) < 1e6))
+    {
+        // Normalized cubic, trigonometric or Cardano solution
+        double an = b/a, bn = c/a, cn = d/a;
+        double a2 = an*an;
+        double q = (a2 - 3.0*bn)/9.0;
+        double r = (an*(2.0*a2 - 9.0*bn) + 27.0*cn)/54.0;
+        double r2 = r*r;
+        double q3 = q*q*q;
+        an /= 3.0;
+
+        if (r2 < q3)
+        {
+            double t = r/sqrt(q3);
+            if (t < -1.0) t = -1.0;
+            if (t > 1.0) t = 1.0;
+            t = acos(t);
+            q = -2.0*sqrt(q);
+
+            roots[0] = q*cos(t/3.0) - an;
+            roots[1] = q*cos((t + 2.0*PI)/3.0) - an;
+            roots[2] = q*cos((t - 2.0*PI)/3.0) - an;
+            return 3;
+        }
+        else
+        {
+            double u = ((r < 0.0)? 1.0 : -1.0)*pow(fabs(r) + sqrt(r2 - q3), 1.0/3.0);
+            double v = (u == 0.0)? 0.0 : q/u;
+
+            roots[0] = (u + v) - an;
+
+            if ((u == v) || (fabs(u - v) < 1e-12*fabs(u + v)))
+            {
+                roots[1] = -0.5*(u + v) - an;
+                return 2;
+            }
+
+            return 1;
+        }
+    }
+
+    if (b == 0.0)
+    {
+        if (c == 0.0) return 0;
+        roots[0] = -d/c;
+        return 1;
+    }
+
+    double discriminant = c*c - 4.0*b*d;
+
+    if (discriminant > 0.0)
+    {
+        discriminant = sqrt(discriminant);
+        roots[0] = (-c + discriminant)/(2.0*b);
+        roots[1] = (-c - discriminant)/(2.0*b);
+        return 2;
+    }
+    else if (discriminant == 0.0)
+    {
+        roots[0] = -c/(2.0*b);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Set dynamic font lookup table entry, -1 to remove it
+// NOTE: Removed hash entries are marked (-2) to keep probing sequences,
+// hash table is rebuilt from resident glyphs when too many entries are used
+static void SetGlyphLookupIndex(Font font, int codepoint, int index)
+{
+    rGlyphLookup *lookup = font.lookup;
+
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        int *page = lookup->pages[codepoint >> 8];
+
+        if (page == NULL)
+        {
+            if (index < 0) return;
+
+            page = (int *)RL_MALLOC(256*sizeof(int));
+            for (int j = 0; j < 256; j++) page[j] = -1;
+            lookup->pages[codepoint >> 8] = page;
+        }
+
+        page[codepoint & 0xff] = index;
+    }
+    else if (index < 0)
+    {
+        for (unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashCapacity - 1); lookup->hashCodepoints[slot] != -1; slot = (slot + 1) & (lookup->hashCapacity - 1))
+        {
+            if (lookup->hashCodepoints[slot] == codepoint)
+            {
+                lookup->hashCodepoints[slot] = -2;
+                lookup->hashIndices[slot] = -1;
+                break;
+            }
+        }
+    }
+    else
+    {
+        if ((lookup->dynamic->hashUsed + 1) > (lookup->hashCapacity*3/4))
+        {
+            // Rebuild hash table with resident glyphs out of BMP
+            for (int i = 0; i < lookup->hashCapacity; i++) lookup->hashCodepoints[i] = -1;
+            lookup->dynamic->hashUsed = 0;
+
+            for (int i = 0; i < font.glyphCount; i++)
+            {
+                int value = font.glyphs[i].value;
+
+                if ((lookup->dynamic->glyphShelf[i] != -1) && ((value < 0) || (value > 0xffff)))
                 {
-                    buffer[i] = '_';
-                    i++;
+                    unsigned int slot = ((unsigned int)value*2654435761u) & (lookup->hashCapacity - 1);
+                    while (lookup->hashCodepoints[slot] != -1) slot = (slot + 1) & (lookup->hashCapacity - 1);
+
+                    lookup->hashCodepoints[slot] = value;
+                    lookup->hashIndices[slot] = i;
+                    lookup->dynamic->hashUsed++;
                 }
-                buffer[i] = text[j] + 32;
             }
-            else buffer[i] = text[j];
         }
+
+        // NOTE: Codepoint is not in the table, first free or removed entry is used
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & (lookup->hashCapacity - 1);
+        while (lookup->hashCodepoints[slot] >= 0) slot = (slot + 1) & (lookup->hashCapacity - 1);
+
+        if (lookup->hashCodepoints[slot] == -1) lookup->dynamic->hashUsed++;
+        lookup->hashCodepoints[slot] = codepoint;
+        lookup->hashIndices[slot] = index;
     }
+}
 
-    return buffer;
+// Rasterize glyph into dynamic font atlas, returns glyph index or -1 if atlas packing failed
+// NOTE: Codepoints not available in font (or not fitting the atlas) are added to lookup table
+// with fallback glyph index, so they are not checked again on every lookup
+static int LoadFontDynamicGlyph(Font font, int codepoint)
+{
+    rFontDynamic *dynamic = font.lookup->dynamic;
+
+    int glyphIndex = stbtt_FindGlyphIndex(&dynamic->fontInfo, codepoint);
+    if (glyphIndex <= 0)
+    {
+        SetGlyphLookupIndex(font, codepoint, font.lookup->fallbackIndex);
+        return font.lookup->fallbackIndex;
+    }
+
+    int width = 0, height = 0, offsetX = 0, offsetY = 0;
+    unsigned char *bitmap = stbtt_GetGlyphBitmap(&dynamic->fontInfo, dynamic->scaleFactor, dynamic->scaleFactor, glyphIndex, &width, &height, &offsetX, &offsetY);
+
+    int padding = font.glyphPadding;
+
+    if ((width + 2*padding) > dynamic->atlasSize)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] does not fit into dynamic font atlas", codepoint);
+        stbtt_FreeBitmap(bitmap, NULL);
+        SetGlyphLookupIndex(font, codepoint, font.lookup->fallbackIndex);
+        return font.lookup->fallbackIndex;
+    }
+
+    if ((height + 2*padding) > dynamic->shelfHeight) height = dynamic->shelfHeight - 2*padding;
+
+    // Get a free glyph slot, evicting least recently used shelf if required
+    int index = -1;
+
+    while (index == -1)
+    {
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (dynamic->glyphShelf[i] == -1) { index = i; break; }
+        }
+
+        if (index == -1)
+        {
+            int lruShelf = -1;
+
+            for (int i = 0; i < dynamic->shelfCount; i++)
+            {
+                if ((dynamic->shelfOffset[i] > ((i == 0)? dynamic->fallbackWidth : 0)) &&
+                    ((lruShelf == -1) || (dynamic->shelfLastUse[i] < dynamic->shelfLastUse[lruShelf]))) lruShelf = i;
+            }
+
+            if (lruShelf == -1) break;
+            EvictFontDynamicShelf(font, lruShelf);
+        }
+    }
+
+    // Get a shelf with enough space left, evicting least recently used shelf if required
+    int shelf = -1;
+
+    if (index != -1)
+    {
+        for (int i = 0; i < dynamic->shelfCount; i++)
+        {
+            if ((dynamic->shelfOffset[i] + width + 2*padding) <= dynamic->atlasSize) { shelf = i; break; }
+        }
+
+        if (shelf == -1)
+        {
+            for (int i = 0; i < dynamic->shelfCount; i++)
+            {
+                if (((((i == 0)? dynamic->fallbackWidth : 0) + width + 2*padding) <= dynamic->atlasSize) &&
+                    ((shelf == -1) || (dynamic->shelfLastUse[i] < dynamic->shelfLastUse[shelf]))) shelf = i;
+            }
+
+            if (shelf != -1) EvictFontDynamicShelf(font, shelf);
+        }
+    }
+
+    if (shelf == -1)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to package character [0x%08x] into dynamic font atlas", codepoint);
+        stbtt_FreeBitmap(bitmap, NULL);
+        return -1;
+    }
+
+    int x = dynamic->shelfOffset[shelf];
+    int y = shelf*dynamic->shelfHeight;
+
+    // Glyph image, gray+alpha as the static fonts atlas
+    // NOTE: Padding is uploaded too, clearing previous glyphs pixels in reused shelves
+    int paddedWidth = width + 2*padding;
+    int paddedHeight = height + 2*padding;
+    unsigned char *pixels = (unsigned char *)RL_CALLOC(paddedWidth*paddedHeight, 2);
+
+    GlyphInfo *glyph = &font.glyphs[index];
+    glyph->value = codepoint;
+    glyph->offsetX = offsetX;
+    glyph->offsetY = (bitmap != NULL)? offsetY + dynamic->ascent : offsetY;
+    stbtt_GetGlyphHMetrics(&dynamic->fontInfo, glyphIndex, &glyph->advanceX, NULL);
+    glyph->advanceX = (int)((float)glyph->advanceX*dynamic->scaleFactor);
+    glyph->image.data = RL_MALLOC(width*height*2);
+    glyph->image.width = width;
+    glyph->image.height = height;
+    glyph->image.mipmaps = 1;
+    glyph->image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    for (int py = 0; py < paddedHeight; py++)
+    {
+        for (int px = 0; px < paddedWidth; px++) pixels[(py*paddedWidth + px)*2] = 255;
+    }
+
+    for (int py = 0; py < height; py++)
+    {
+        for (int px = 0; px < width; px++)
+        {
+            unsigned char value = bitmap[py*width + px];
+
+            pixels[((py + padding)*paddedWidth + px + padding)*2 + 1] = value;
+            ((unsigned char *)glyph->image.data)[(py*width + px)*2] = 255;
+            ((unsigned char *)glyph->image.data)[(py*width + px)*2 + 1] = value;
+        }
+    }
+
+    stbtt_FreeBitmap(bitmap, NULL);
+
+    if (isGpuReady) rlUpdateTexture(font.texture.id, x, y, paddedWidth, paddedHeight, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, pixels);
+    RL_FREE(pixels);
+
+    font.recs[index] = (Rectangle){ (float)(x + padding), (float)(y + padding), (float)width, (float)height };
+
+    dynamic->glyphShelf[index] = shelf;
+    dynamic->shelfOffset[shelf] += paddedWidth;
+    dynamic->useCounter++;
+    dynamic->shelfLastUse[shelf] = dynamic->useCounter;
+
+    SetGlyphLookupIndex(font, codepoint, index);
+
+    return index;
 }
 
-// Get Camel case notation version of provided string
-// WARNING: Limited functionality, only basic characters set
-char *TextToCamel(const char *text)
+#if defined(SUPPORT_FONT_KERNING)
+// Load kerning pairs into lookup table
+// NOTE: stb_truetype can not enumerate GPOS pairs, all pairs of the first FONT_KERNING_MAX_GLYPHS
+// codepoints are checked once on loading, kerning is then a hash table lookup when drawing
+static void LoadGlyphKerning(rGlyphLookup *lookup, const stbtt_fontinfo *fontInfo, float scaleFactor, const int *codepoints, int codepointCount)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    if ((lookup == NULL) || ((fontInfo->gpos == 0) && (fontInfo->kern == 0))) return;
+    if (codepointCount > FONT_KERNING_MAX_GLYPHS) codepointCount = FONT_KERNING_MAX_GLYPHS;
 
-    if (text != NULL)
+    int *glyphIndices = (int *)RL_MALLOC(codepointCount*sizeof(int));
+    for (int i = 0; i < codepointCount; i++) glyphIndices[i] = stbtt_FindGlyphIndex(fontInfo, codepoints[i]);
+
+    int pairCount = 0;
+    int pairCapacity = 256;
+    int *pairs = (int *)RL_MALLOC(2*pairCapacity*sizeof(int));
+    float *values = (float *)RL_MALLOC(pairCapacity*sizeof(float));
+
+    for (int i = 0; i < codepointCount; i++)
     {
-        // Lower case first character
-        if ((text[0] >= 'A') && (text[0] <= 'Z')) buffer[0] = text[0] + 32;
-        else buffer[0] = text[0];
+        if ((glyphIndices[i] == 0) || (codepoints[i] <= 0)) continue;
 
-        // Check for next separator to upper case another character
-        for (int i = 1, j = 1; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[j] != '\0'); i++, j++)
+        for (int j = 0; j < codepointCount; j++)
         {
-            if (text[j] != '_') buffer[i] = text[j];
-            else
+            if (glyphIndices[j] == 0) continue;
+
+            int kerning = stbtt_GetGlyphKernAdvance(fontInfo, glyphIndices[i], glyphIndices[j]);
+            if (kerning == 0) continue;
+
+            if (pairCount == pairCapacity)
             {
-                j++;
-                if ((text[j] >= 'a') && (text[j] <= 'z')) buffer[i] = text[j] - 32;
+                pairCapacity *= 2;
+                pairs = (int *)RL_REALLOC(pairs, 2*pairCapacity*sizeof(int));
+                values = (float *)RL_REALLOC(values, pairCapacity*sizeof(float));
             }
+
+            pairs[2*pairCount] = codepoints[i];
+            pairs[2*pairCount + 1] = codepoints[j];
+            values[pairCount] = (float)kerning*scaleFactor;
+            pairCount++;
         }
     }
 
-    return buffer;
+    LoadKerningTable(lookup, pairs, values, pairCount);
+
+    RL_FREE(glyphIndices);
+    RL_FREE(pairs);
+    RL_FREE(values);
 }
+#endif
 
-// Encode text codepoint into UTF-8 text
-// REQUIRES: memcpy()
-// WARNING: Allocated memory must be manually freed
-char *LoadUTF8(const int *codepoints, int length)
+// Evict all glyphs in a dynamic font atlas shelf
+// NOTE: Pending batch is drawn first, it could reference evicted glyphs
+static void EvictFontDynamicShelf(Font font, int shelf)
 {
-    // We allocate enough memory to fit all possible codepoints
-    // NOTE: 5 bytes for every codepoint should be enough
-    char *text = (char *)RL_CALLOC(length*5, 1);
-    const char *utf8 = NULL;
-    int size = 0;
+    rFontDynamic *dynamic = font.lookup->dynamic;
+
+    if (isGpuReady) rlDrawRenderBatchActive();
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (dynamic->glyphShelf[i] == shelf)
+        {
+            SetGlyphLookupIndex(font, font.glyphs[i].value, -1);
+            UnloadImage(font.glyphs[i].image);
+            font.glyphs[i] = (GlyphInfo){ 0 };
+            font.recs[i] = (Rectangle){ 0 };
+            dynamic->glyphShelf[i] = -1;
+        }
+    }
+
+    dynamic->shelfOffset[shelf] = (shelf == 0)? dynamic->fallbackWidth : 0;
+    dynamic->shelfLastUse[shelf] = 0;
+}
+#endif
+
+// Replace text view line bytes
+// NOTE: Inserted text can not point to the same line text
+static void ReplaceTextViewLineText(TextViewLine *line, int start, int removeCount, const char *text, int insertCount)
+{
+    int length = line->length - removeCount + insertCount;
 
-    for (int i = 0, bytes = 0; i < length; i++)
+    if ((length + 1) > line->capacity)
     {
-        utf8 = CodepointToUTF8(codepoints[i], &bytes);
-        memcpy(text + size, utf8, bytes);
-        size += bytes;
+        line->capacity = (length + 1 > 2*line->capacity)? length + 1 : 2*line->capacity;
+        line->text = (char *)RL_REALLOC(line->text, line->capacity);
     }
 
-    // Resize memory to text length + string NULL terminator
-    void *ptr = RL_REALLOC(text, size + 1);
-
-    if (ptr != NULL) text = (char *)ptr;
+    memmove(line->text + start + insertCount, line->text + start + removeCount, line->length - start - removeCount);
+    if (insertCount > 0) memcpy(line->text + start, text, insertCount);
 
-    return text;
+    line->length = length;
+    line->text[length] = '\0';
 }
 
-// Unload UTF-8 text encoded from codepoints array
-void UnloadUTF8(char *text)
+// Wrap text view line, rows start cached when line takes more than one row
+// NOTE: Wrapping is the same as UpdateTextLayout(), words are wrapped at spaces,
+// words longer than wrapping width are broken at any glyph
+static void WrapTextViewLine(rTextViewData *data, TextViewLine *line)
 {
-    RL_FREE(text);
-}
+    RL_FREE(line->rowStart);
+    line->rowStart = NULL;
+    line->rowCount = 1;
 
-// Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-int *LoadCodepoints(const char *text, int *count)
-{
-    int textLength = TextLength(text);
+    if (data->wrapWidth <= 0.0f) return;
 
-    int codepointSize = 0;
-    int codepointCount = 0;
+    Font font = data->font;
+    float scaleFactor = data->fontSize/font.baseSize;
+    int rowCapacity = 0;
 
-    // Allocate a big enough buffer to store as many codepoints as text bytes
-    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+    float offsetX = 0.0f;           // Next glyph position in current row
+    int previous = 0;               // Previous codepoint for kerning, 0 after spaces
+    bool rowContent = false;        // Current row contains glyphs (spaces not included)
+    int breakByte = -1;             // First byte after last space in current row, -1 if none
+    float breakX = 0.0f;            // Position of first byte after last space in current row
 
-    for (int i = 0; i < textLength; codepointCount++)
+    for (int i = 0; i < line->length;)
     {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
-    }
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&line->text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+        float advance = ((font.glyphs[index].advanceX == 0)? (float)font.recs[index].width : (float)font.glyphs[index].advanceX)*scaleFactor;
 
-    // Re-allocate buffer to the actual number of codepoints loaded
-    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+        if ((codepoint == ' ') || (codepoint == '\t'))
+        {
+            if (rowContent) breakByte = i + codepointByteCount;
 
-    *count = codepointCount;
+            offsetX += (advance + data->spacing);
+            if (breakByte == (i + codepointByteCount)) breakX = offsetX;
+            previous = 0;
 
-    return codepoints;
-}
+            i += codepointByteCount;
+            continue;
+        }
 
-// Unload codepoints data from memory
-void UnloadCodepoints(int *codepoints)
-{
-    RL_FREE(codepoints);
-}
+        offsetX += GetLookupKerning(font.lookup, previous, codepoint)*scaleFactor;
+        previous = codepoint;
 
-// Get total number of characters(codepoints) in a UTF-8 encoded text, until '\0' is found
-// NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
-int GetCodepointCount(const char *text)
-{
-    unsigned int length = 0;
-    char *ptr = (char *)&text[0];
+        // Wrap row if glyph does not fit, at last space or at current glyph
+        while (((offsetX + advance) > data->wrapWidth) && rowContent)
+        {
+            int first = (breakByte != -1)? breakByte : i;
+            float shiftX = (breakByte != -1)? breakX : offsetX;
 
-    while (*ptr != '\0')
-    {
-        int next = 0;
-        GetCodepointNext(ptr, &next);
+            if (line->rowCount >= rowCapacity)
+            {
+                rowCapacity = (rowCapacity == 0)? 4 : 2*rowCapacity;
+                line->rowStart = (int *)RL_REALLOC(line->rowStart, rowCapacity*sizeof(int));
+                line->rowStart[0] = 0;
+            }
 
-        ptr += next;
+            line->rowStart[line->rowCount] = first;
+            line->rowCount++;
 
-        length++;
-    }
+            offsetX -= shiftX;
+            rowContent = (first < i);
+            breakByte = -1;
+        }
 
-    return length;
+        rowContent = true;
+        offsetX += (advance + data->spacing);
+        i += codepointByteCount;
+    }
 }
 
-// Encode codepoint into utf8 text (char array length returned as parameter)
-// NOTE: It uses a static array to store UTF-8 bytes
-const char *CodepointToUTF8(int codepoint, int *utf8Size)
+// Insert empty lines in text view
+// NOTE: Rows index is not updated, it must be built again
+static void InsertTextViewLines(rTextViewData *data, int line, int count)
 {
-    static char utf8[6] = { 0 };
-    memset(utf8, 0, 6); // Clear static array
-    int size = 0;       // Byte size of codepoint
-
-    if (codepoint <= 0x7f)
+    if ((data->lineCount + count) > data->lineCapacity)
     {
-        utf8[0] = (char)codepoint;
-        size = 1;
+        data->lineCapacity = (data->lineCount + count > 2*data->lineCapacity)? data->lineCount + count : 2*data->lineCapacity;
+        data->lines = (TextViewLine *)RL_REALLOC(data->lines, data->lineCapacity*sizeof(TextViewLine));
+        data->rowIndex = (int *)RL_REALLOC(data->rowIndex, (data->lineCapacity + 1)*sizeof(int));
     }
-    else if (codepoint <= 0x7ff)
+
+    memmove(&data->lines[line + count], &data->lines[line], (data->lineCount - line)*sizeof(TextViewLine));
+    memset(&data->lines[line], 0, count*sizeof(TextViewLine));
+
+    for (int i = line; i < (line + count); i++)
     {
-        utf8[0] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
-        utf8[1] = (char)((codepoint & 0x3f) | 0x80);
-        size = 2;
+        data->lines[i].capacity = 1;
+        data->lines[i].text = (char *)RL_CALLOC(1, 1);
+        data->lines[i].rowCount = 1;
     }
-    else if (codepoint <= 0xffff)
+
+    data->lineCount += count;
+}
+
+// Build text view rows index, O(n)
+static void BuildTextViewRows(rTextViewData *data)
+{
+    data->rowCount = 0;
+    data->rowIndex[0] = 0;
+
+    for (int i = 1; i <= data->lineCount; i++)
     {
-        utf8[0] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
-        utf8[1] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[2] = (char)((codepoint & 0x3f) | 0x80);
-        size = 3;
+        data->rowIndex[i] = data->lines[i - 1].rowCount;
+        data->rowCount += data->lines[i - 1].rowCount;
     }
-    else if (codepoint <= 0x10ffff)
+
+    for (int i = 1; i <= data->lineCount; i++)
     {
-        utf8[0] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
-        utf8[1] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
-        utf8[2] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
-        utf8[3] = (char)((codepoint & 0x3f) | 0x80);
-        size = 4;
+        int parent = i + (i & -i);
+        if (parent <= data->lineCount) data->rowIndex[parent] += data->rowIndex[i];
     }
+}
 
-    *utf8Size = size;
+// Update text view rows index for one line rows count change, O(log n)
+static void UpdateTextViewRows(rTextViewData *data, int line, int delta)
+{
+    if (delta == 0) return;
 
-    return utf8;
+    for (int i = line + 1; i <= data->lineCount; i += (i & -i)) data->rowIndex[i] += delta;
+    data->rowCount += delta;
 }
-#endif      // SUPPORT_TEXT_MANIPULATION
 
-// Get next codepoint in a UTF-8 encoded text, scanning until '\0' is found
-// When an invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
-// Total number of bytes processed are returned as a parameter
-// NOTE: The standard says U+FFFD should be returned in case of errors
-// but that character is not supported by the default font in raylib
-int GetCodepoint(const char *text, int *codepointSize)
+// Get text view rows count before line, O(log n)
+static int GetTextViewRowsBefore(rTextViewData *data, int line)
 {
-/*
-    UTF-8 specs from https://www.ietf.org/rfc/rfc3629.txt
+    int rows = 0;
 
-    Char. number range  |        UTF-8 octet sequence
-      (hexadecimal)    |              (binary)
-    --------------------+---------------------------------------------
-    0000 0000-0000 007F | 0xxxxxxx
-    0000 0080-0000 07FF | 110xxxxx 10xxxxxx
-    0000 0800-0000 FFFF | 1110xxxx 10xxxxxx 10xxxxxx
-    0001 0000-0010 FFFF | 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-*/
-    // NOTE: on decode errors we return as soon as possible
+    for (int i = line; i > 0; i -= (i & -i)) rows += data->rowIndex[i];
 
-    int codepoint = 0x3f;   // Codepoint (defaults to '?')
-    int octet = (unsigned char)(text[0]); // The first UTF8 octet
-    *codepointSize = 1;
+    return rows;
+}
 
-    if (octet <= 0x7f)
+// Get text view line containing row and row in line, O(log n)
+// NOTE: Row must be lower than total rows count
+static int GetTextViewRowLine(rTextViewData *data, int row, int *lineRow)
+{
+    int line = 0;
+    int step = 1;
+    while ((step*2) <= data->lineCount) step *= 2;
+
+    for (; step > 0; step /= 2)
     {
-        // Only one octet (ASCII range x00-7F)
-        codepoint = text[0];
+        if (((line + step) <= data->lineCount) && (data->rowIndex[line + step] <= row))
+        {
+            line += step;
+            row -= data->rowIndex[line];
+        }
     }
-    else if ((octet & 0xe0) == 0xc0)
-    {
-        // Two octets
 
-        // [0]xC2-DF    [1]UTF8-tail(x80-BF)
-        unsigned char octet1 = text[1];
+    *lineRow = row;
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+    return line;
+}
 
-        if ((octet >= 0xc2) && (octet <= 0xdf))
+// Append text bytes to builder, truncated if it does not fit
+static void AppendTextBuilderBytes(TextBuilder *builder, const char *text, int length)
+{
+    if ((builder->length + length) >= builder->capacity)
+    {
+        if (builder->owned)
         {
-            codepoint = ((octet & 0x1f) << 6) | (octet1 & 0x3f);
-            *codepointSize = 2;
+            builder->capacity = ((builder->length + length + 1) > 2*builder->capacity)? (builder->length + length + 1) : 2*builder->capacity;
+            builder->text = (char *)RL_REALLOC(builder->text, builder->capacity);
+        }
+        else
+        {
+            builder->truncated = true;
+            length = builder->capacity - builder->length - 1;
+            if (length <= 0) return;
         }
     }
-    else if ((octet & 0xf0) == 0xe0)
-    {
-        // Three octets
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+    memcpy(builder->text + builder->length, text, length);
+    builder->length += length;
+    builder->text[builder->length] = '\0';
+}
 
-        octet2 = text[2];
+// Load binary font data, empty font on failure
+// NOTE: Atlas pixels are uploaded to GPU directly from file data
+static Font LoadFontBinaryData(const unsigned char *fileData, int dataSize)
+{
+    Font font = { 0 };
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; } // Unexpected sequence
+    if ((fileData == NULL) || (dataSize < (int)sizeof(FontBinaryHeader))) return font;
 
-        // [0]xE0    [1]xA0-BF       [2]UTF8-tail(x80-BF)
-        // [0]xE1-EC [1]UTF8-tail    [2]UTF8-tail(x80-BF)
-        // [0]xED    [1]x80-9F       [2]UTF8-tail(x80-BF)
-        // [0]xEE-EF [1]UTF8-tail    [2]UTF8-tail(x80-BF)
+    FontBinaryHeader header = { 0 };
+    memcpy(&header, fileData, sizeof(FontBinaryHeader));
 
-        if (((octet == 0xe0) && !((octet1 >= 0xa0) && (octet1 <= 0xbf))) ||
-            ((octet == 0xed) && !((octet1 >= 0x80) && (octet1 <= 0x9f)))) { *codepointSize = 2; return codepoint; }
+    if ((memcmp(header.id, "rFNB", 4) != 0) || (header.version != FONT_BINARY_VERSION)) return font;
 
-        if ((octet >= 0xe0) && (octet <= 0xef))
+    // Security checks: negative values and sections out of file data bounds,
+    // sizes computed in 64 bit to avoid overflows with corrupt headers
+    if ((header.baseSize <= 0) || (header.glyphCount <= 0) || (header.glyphPadding < 0) || (header.kerningCount < 0) ||
+        (header.atlasWidth <= 0) || (header.atlasHeight <= 0) || (header.atlasWidth > 16384) || (header.atlasHeight > 16384) ||
+        (header.atlasFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (header.atlasFormat > PIXELFORMAT_UNCOMPRESSED_R16G16B16A16) ||
+        (header.glyphsOffset < 0) || (header.recsOffset < 0) || (header.kerningOffset < 0) || (header.atlasOffset < 0) ||
+        (header.atlasDataSize != GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat)) ||
+        (((long long)header.glyphsOffset + (long long)header.glyphCount*16) > dataSize) ||
+        (((long long)header.recsOffset + (long long)header.glyphCount*16) > dataSize) ||
+        (((long long)header.kerningOffset + (long long)header.kerningCount*12) > dataSize) ||
+        (((long long)header.atlasOffset + header.atlasDataSize) > dataSize)) return font;
+
+    // Glyphs rectangles must lay inside the atlas, required by ImageFromImage()
+    for (int i = 0; i < header.glyphCount; i++)
+    {
+        Rectangle rec = { 0 };
+        memcpy(&rec, fileData + header.recsOffset + i*sizeof(Rectangle), sizeof(Rectangle));
+
+        // NOTE: Comparisons written to also fail with NaN values
+        if (!((rec.x >= 0) && (rec.y >= 0) && (rec.width >= 0) && (rec.height >= 0) &&
+              ((rec.x + rec.width) <= header.atlasWidth) && ((rec.y + rec.height) <= header.atlasHeight)))
         {
-            codepoint = ((octet & 0xf) << 12) | ((octet1 & 0x3f) << 6) | (octet2 & 0x3f);
-            *codepointSize = 3;
+            TRACELOG(LOG_WARNING, "FONT: Binary font glyph rectangle [%i] out of atlas bounds", i);
+            return font;
         }
     }
-    else if ((octet & 0xf8) == 0xf0)
-    {
-        // Four octets
-        if (octet > 0xf4) return codepoint;
 
-        unsigned char octet1 = text[1];
-        unsigned char octet2 = '\0';
-        unsigned char octet3 = '\0';
+    font.baseSize = header.baseSize;
+    font.glyphCount = header.glyphCount;
+    font.glyphPadding = header.glyphPadding;
 
-        if ((octet1 == '\0') || ((octet1 >> 6) != 2)) { *codepointSize = 2; return codepoint; }  // Unexpected sequence
+    // Atlas image pointing to file data, no copy required
+    Image atlas = { 0 };
+    atlas.data = (void *)(fileData + header.atlasOffset);
+    atlas.width = header.atlasWidth;
+    atlas.height = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = header.atlasFormat;
 
-        octet2 = text[2];
+    if (isGpuReady)
+    {
+        font.texture = LoadTextureFromImage(atlas);
+        if ((header.type == FONT_SDF) || (header.type == FONT_MSDF)) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    }
 
-        if ((octet2 == '\0') || ((octet2 >> 6) != 2)) { *codepointSize = 3; return codepoint; }  // Unexpected sequence
+    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+    memcpy(font.recs, fileData + header.recsOffset, font.glyphCount*sizeof(Rectangle));
 
-        octet3 = text[3];
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
 
-        if ((octet3 == '\0') || ((octet3 >> 6) != 2)) { *codepointSize = 4; return codepoint; }  // Unexpected sequence
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        // NOTE: Sections offsets could be unaligned on corrupt files, data copied
+        int glyphData[4] = { 0 };
+        memcpy(glyphData, fileData + header.glyphsOffset + 16*i, 4*sizeof(int));
 
-        // [0]xF0       [1]x90-BF       [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF1-F3    [1]UTF8-tail    [2]UTF8-tail  [3]UTF8-tail
-        // [0]xF4       [1]x80-8F       [2]UTF8-tail  [3]UTF8-tail
+        font.glyphs[i].value = glyphData[0];
+        font.glyphs[i].offsetX = glyphData[1];
+        font.glyphs[i].offsetY = glyphData[2];
+        font.glyphs[i].advanceX = glyphData[3];
 
-        if (((octet == 0xf0) && !((octet1 >= 0x90) && (octet1 <= 0xbf))) ||
-            ((octet == 0xf4) && !((octet1 >= 0x80) && (octet1 <= 0x8f)))) { *codepointSize = 2; return codepoint; } // Unexpected sequence
+        // Glyphs images, required by ImageTextEx()
+        font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
 
-        if (octet >= 0xf0)
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+    if (font.lookup != NULL) font.lookup->type = header.type;
+
+    if ((font.lookup != NULL) && (header.kerningCount > 0))
+    {
+        int *pairs = (int *)RL_MALLOC(2*header.kerningCount*sizeof(int));
+        float *values = (float *)RL_MALLOC(header.kerningCount*sizeof(float));
+
+        for (int i = 0; i < header.kerningCount; i++)
         {
-            codepoint = ((octet & 0x7) << 18) | ((octet1 & 0x3f) << 12) | ((octet2 & 0x3f) << 6) | (octet3 & 0x3f);
-            *codepointSize = 4;
+            memcpy(&pairs[2*i], fileData + header.kerningOffset + 12*i, 2*sizeof(int));
+            memcpy(&values[i], fileData + header.kerningOffset + 12*i + 8, sizeof(float));
         }
-    }
 
-    if (codepoint > 0x10ffff) codepoint = 0x3f;     // Codepoints after U+10ffff are invalid
+        LoadKerningTable(font.lookup, pairs, values, header.kerningCount);
 
-    return codepoint;
+        RL_FREE(pairs);
+        RL_FREE(values);
+    }
+
+    return font;
 }
 
-// Get next codepoint in a byte sequence and bytes processed
-int GetCodepointNext(const char *text, int *codepointSize)
+// Save binary font file from font and atlas image
+static bool SaveFontBinary(Font font, Image atlas, int type, const char *fileName)
 {
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    *codepointSize = 1;
-
-    // Get current codepoint and bytes processed
-    if (0xf0 == (0xf8 & ptr[0]))
-    {
-        // 4 byte UTF-8 codepoint
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80) || ((ptr[3] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x07 & ptr[0]) << 18) | ((0x3f & ptr[1]) << 12) | ((0x3f & ptr[2]) << 6) | (0x3f & ptr[3]);
-        *codepointSize = 4;
-    }
-    else if (0xe0 == (0xf0 & ptr[0]))
-    {
-        // 3 byte UTF-8 codepoint */
-        if (((ptr[1] & 0xC0) ^ 0x80) || ((ptr[2] & 0xC0) ^ 0x80)) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x0f & ptr[0]) << 12) | ((0x3f & ptr[1]) << 6) | (0x3f & ptr[2]);
-        *codepointSize = 3;
-    }
-    else if (0xc0 == (0xe0 & ptr[0]))
-    {
-        // 2 byte UTF-8 codepoint
-        if ((ptr[1] & 0xC0) ^ 0x80) { return codepoint; } // 10xxxxxx checks
-        codepoint = ((0x1f & ptr[0]) << 6) | (0x3f & ptr[1]);
-        *codepointSize = 2;
-    }
-    else if (0x00 == (0x80 & ptr[0]))
+    rGlyphLookup *lookup = font.lookup;
+
+    int kerningCount = 0;
+    if (lookup != NULL) for (int i = 0; i < lookup->kerningCapacity; i++) if (lookup->kerningFirst[i] != -1) kerningCount++;
+
+    FontBinaryHeader header = { 0 };
+    memcpy(header.id, "rFNB", 4);
+    header.version = FONT_BINARY_VERSION;
+    header.baseSize = font.baseSize;
+    header.glyphCount = font.glyphCount;
+    header.glyphPadding = font.glyphPadding;
+    header.type = type;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.kerningCount = kerningCount;
+    header.atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    // Sections offsets, aligned to 16 bytes
+    header.glyphsOffset = sizeof(FontBinaryHeader);
+    header.recsOffset = header.glyphsOffset + font.glyphCount*16;
+    header.kerningOffset = header.recsOffset + font.glyphCount*16;
+    header.atlasOffset = (header.kerningOffset + kerningCount*12 + 15) & ~15;
+
+    int dataSize = header.atlasOffset + header.atlasDataSize;
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+    memcpy(fileData, &header, sizeof(FontBinaryHeader));
+
+    int *glyphsData = (int *)(fileData + header.glyphsOffset);
+    for (int i = 0; i < font.glyphCount; i++)
     {
-        // 1 byte UTF-8 codepoint
-        codepoint = ptr[0];
-        *codepointSize = 1;
+        glyphsData[4*i] = font.glyphs[i].value;
+        glyphsData[4*i + 1] = font.glyphs[i].offsetX;
+        glyphsData[4*i + 2] = font.glyphs[i].offsetY;
+        glyphsData[4*i + 3] = font.glyphs[i].advanceX;
     }
 
-    return codepoint;
-}
+    memcpy(fileData + header.recsOffset, font.recs, font.glyphCount*sizeof(Rectangle));
 
-// Get previous codepoint in a byte sequence and bytes processed
-int GetCodepointPrevious(const char *text, int *codepointSize)
-{
-    const char *ptr = text;
-    int codepoint = 0x3f;       // Codepoint (defaults to '?')
-    int cpSize = 0;
-    *codepointSize = 0;
+    for (int i = 0, k = 0; (lookup != NULL) && (i < lookup->kerningCapacity); i++)
+    {
+        if (lookup->kerningFirst[i] == -1) continue;
 
-    // Move to previous codepoint
-    do ptr--;
-    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+        memcpy(fileData + header.kerningOffset + 12*k, &lookup->kerningFirst[i], sizeof(int));
+        memcpy(fileData + header.kerningOffset + 12*k + 4, &lookup->kerningSecond[i], sizeof(int));
+        memcpy(fileData + header.kerningOffset + 12*k + 8, &lookup->kerningValues[i], sizeof(float));
+        k++;
+    }
 
-    codepoint = GetCodepointNext(ptr, &cpSize);
+    memcpy(fileData + header.atlasOffset, atlas.data, header.atlasDataSize);
 
-    if (codepoint != 0) *codepointSize = cpSize;
+    bool success = SaveFileData(fileName, fileData, dataSize);
 
-    return codepoint;
+    RL_FREE(fileData);
+
+    return success;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2311,6 +5276,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.lookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         UnloadFont(font);
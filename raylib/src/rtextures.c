@@ -34,6 +34,10 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_THREADS
+*           Use multiple threads on CPU heavy image processing, requires POSIX threads (pthreads)
+*           Work is split in contiguous ranges (rows, faces...), only big enough jobs use threads
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -77,6 +81,11 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in block compression encoders]
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_lock() [Used in LoadTextureBatch(), ProcessImageItems()]
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -201,6 +210,15 @@
     #define STBIW_FREE RL_FREE
     #define STBIW_REALLOC RL_REALLOC
 
+    #if defined(SUPPORT_COMPRESSION_API)
+        #include "external/sdefl.h"         // Required for: zsdeflate() [Implementation in rcore]
+
+        // NOTE: PNG deflate compression uses sdefl instead of stbiw zlib implementation,
+        // it is faster and it allows store mode (no compression)
+        #define STBIW_ZLIB_COMPRESS CompressImageExportData
+        static unsigned char *CompressImageExportData(unsigned char *data, int dataSize, int *compDataSize, int level);
+    #endif
+
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
 #endif
@@ -236,10 +254,252 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef BLOCK_COMPRESSION_REFINE_ITERATIONS
+    #define BLOCK_COMPRESSION_REFINE_ITERATIONS  1  // Endpoints refinement iterations on DXT compression (quality), 0 for fastest
+#endif
+
+#ifndef TEXTURE_ATLAS_PADDING
+    #define TEXTURE_ATLAS_PADDING     1    // Padding in pixels between texture atlas regions, avoids filtering bleeding
+#endif
+
+#ifndef VIRTUAL_TEXTURE_PAGE_BORDER
+    #define VIRTUAL_TEXTURE_PAGE_BORDER       1    // Border in pixels around virtual texture pages in cache, required for bilinear filtering
+#endif
+#ifndef VIRTUAL_TEXTURE_MAX_PAGE_UPLOADS
+    #define VIRTUAL_TEXTURE_MAX_PAGE_UPLOADS 16    // Maximum virtual texture pages uploaded per update
+#endif
+#ifndef CUBEMAP_PREFILTER_SAMPLES
+    #define CUBEMAP_PREFILTER_SAMPLES        64    // Number of samples per texel for cubemap specular prefiltering
+#endif
+#ifndef TEXTURE_BATCH_MAX_THREADS
+    #define TEXTURE_BATCH_MAX_THREADS         4    // Maximum number of threads decoding textures batch images [SUPPORT_IMAGE_THREADS]
+#endif
+#ifndef ROTATE_TILE_SIZE
+    #define ROTATE_TILE_SIZE                 32    // Tile size in pixels for 90 degrees images rotation, source and destination tiles stay in cache
+#endif
+#ifndef IMAGE_PROCESS_MAX_THREADS
+    #define IMAGE_PROCESS_MAX_THREADS         8    // Maximum number of threads processing an image [SUPPORT_IMAGE_THREADS]
+#endif
+#ifndef IMAGE_PROCESS_THREAD_MIN_WORK
+    #define IMAGE_PROCESS_THREAD_MIN_WORK 65536    // Minimum work (pixels or equivalent) per thread processing an image [SUPPORT_IMAGE_THREADS]
+#endif
+#ifndef IMAGE_REGION_MAX_DECODE_PIXELS
+    #define IMAGE_REGION_MAX_DECODE_PIXELS 16777216 // Maximum image pixels fully decoded by LoadImageRegion*() for formats without streaming (4096x4096)
+#endif
+
+#define PNG_INFLATE_WINDOW_SIZE       32768    // Inflate window size kept for back-references (deflate maximum distance)
+#define PNG_INFLATE_CHUNK_SIZE        32768    // Inflate output size decoded between rows updates
+
+#ifndef MIN
+    #define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+#ifndef MAX
+    #define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Skyline node, top edge of an already packed area
+typedef struct SkylineNode {
+    int x;                      // Node start position x
+    int y;                      // Node top edge position y
+    int width;                  // Node width
+} SkylineNode;
+
+// Skyline rectangles packer
+typedef struct SkylinePacker {
+    int width;                  // Packing area width
+    int height;                 // Packing area height
+    int nodeCount;              // Skyline nodes count
+    SkylineNode *nodes;         // Skyline nodes, sorted by position x
+} SkylinePacker;
+
+// Texture atlas internal data
+struct rAtlasData {
+    Image image;                // Atlas pixel data copy (RAM), required for regions repacking
+    SkylinePacker *packer;      // Atlas regions packer
+    int freeCount;              // Number of free rectangles
+    int freeCapacity;           // Number of free rectangles allocated
+    Rectangle *freeRecs;        // Free rectangles below skyline, released by removed or evicted regions (padding included)
+    int usedArea;               // Area used by live regions (padding included)
+    int regionCount;            // Number of region ids assigned
+    int regionCapacity;         // Number of region ids allocated
+    Rectangle *recs;            // Regions rectangles in atlas, empty if region removed or evicted
+    unsigned int *lastUse;      // Regions last use stamp (LRU eviction), 0 if region removed
+    unsigned int useCounter;    // Regions use counter
+};
+
+// Virtual texture internal data
+struct rVirtualTextureData {
+    int pageSize;               // Page size in pixels (without border)
+    int levelCount;             // Number of mip levels, coarsest level fits in a single page
+    Image *levels;              // Pages source mip levels (RAM), R8G8B8A8 format
+    int *levelPagesX;           // Number of pages in every level, horizontal
+    int *levelPagesY;           // Number of pages in every level, vertical
+    int *levelOffset;           // First page index of every level
+    int pageCount;              // Number of pages in all levels
+    int *pageSlot;              // Cache slot of every page, -1 if not resident
+    unsigned int *pageRequest;  // Frame every page was last requested
+    int *requests;              // Requested pages pending to be loaded
+    int slotsX;                 // Cache slots, horizontal
+    int slotsY;                 // Cache slots, vertical
+    int *slotPage;              // Page stored in every cache slot, -1 if empty
+    unsigned int *slotLastUse;  // Frame every cache slot was last used (LRU eviction), UINT_MAX for locked slots
+    unsigned int frameCounter;  // Feedback updates counter
+    unsigned char *indirection; // Indirection table pixel data (RAM), one texel per base level page
+    unsigned char *pageBuffer;  // Page pixel data (with border) ready for upload
+};
+
+// Texture batch file loading state
+typedef enum {
+    TEXTURE_BATCH_FILE_PENDING = 0,     // File pending to be decoded
+    TEXTURE_BATCH_FILE_DECODED,         // File decoded into image (RAM), pending to be uploaded
+    TEXTURE_BATCH_FILE_PROCESSED        // Texture uploaded (VRAM) or loading failed
+} TextureBatchFileState;
+
+// Texture batch internal data
+struct rTextureBatchData {
+    int count;                  // Number of files in batch
+    char **fileNames;           // Files names (shared with batch)
+    Image *images;              // Decoded images pending to be uploaded
+    unsigned char *states;      // Files loading state (TextureBatchFileState)
+    int nextFile;               // Next file to be decoded
+    int firstPending;           // First file not processed yet
+    int decoded;                // Number of files decoded (or failed to decode)
+#if defined(SUPPORT_IMAGE_THREADS)
+    bool cancel;                // Stop decoding files, batch is being unloaded
+    int threadCount;            // Number of decoding threads running
+    pthread_t threads[TEXTURE_BATCH_MAX_THREADS]; // Decoding threads
+    pthread_mutex_t mutex;      // Mutex protecting files state, images and counters
+#endif
+};
+
+// Image processing function, processes items (rows, faces...) range [start, end)
+typedef void (*ImageProcessCallback)(void *data, int start, int end);
+
+#if defined(SUPPORT_IMAGE_THREADS)
+// Image processing batch, items range processed by a single thread
+typedef struct ImageProcessBatch {
+    ImageProcessCallback process;   // Processing function
+    void *data;                     // Processing data, shared by all batches
+    int start;                      // First item to process
+    int end;                        // Last item to process (not included)
+} ImageProcessBatch;
+#endif
+
+// Image rows fill, first row already filled is copied to other rows [ImageClearBackground(), ImageDrawRectangleRec()]
+typedef struct ImageRowsFill {
+    unsigned char *firstRow;    // First row pixel data, already filled
+    size_t rowStride;           // Bytes between consecutive rows start
+    int bytesPerRow;            // Bytes to copy per row
+} ImageRowsFill;
+
+// Image rotation, source and destination pixel data [ImageRotate(), ImageRotateCW(), ImageRotateCCW()]
+typedef struct ImageRotation {
+    const unsigned char *src;   // Source pixel data
+    unsigned char *dst;         // Destination pixel data
+    int srcWidth;               // Source image width
+    int srcHeight;              // Source image height
+    int dstWidth;               // Destination image width
+    int dstHeight;              // Destination image height
+    int bytesPerPixel;          // Pixel data size
+    bool clockwise;             // Rotation direction, 90 degrees rotations
+    float sinRadius;            // Rotation angle sine, other angles rotations
+    float cosRadius;            // Rotation angle cosine, other angles rotations
+} ImageRotation;
+
+// Image generation parameters, shared by all generated rows [GenImageGradientRadial(), GenImageGradientSquare(), GenImagePerlinNoise(), GenImageCellular()]
+typedef struct ImageGeneration {
+    Color *pixels;              // Generated pixels data
+    int width;                  // Image width
+    int height;                 // Image height
+    Color inner;                // Gradient inner color
+    Color outer;                // Gradient outer color
+    float density;              // Gradient density
+    const float *samplesX;      // Values per column, computed once: gradient normalized distances, noise sample positions
+    int offsetY;                // Noise vertical offset
+    float scale;                // Noise scale
+    const int *seeds;           // Cellular seeds positions (x, y)
+    int tileSize;               // Cellular tile size
+} ImageGeneration;
+
+// Cubemap generation, faces are stored in vertical line layout, processed by rows [GenImageCubemap*()]
+typedef struct CubemapGeneration {
+    Vector4 *faces;             // Generated faces pixels data
+    int size;                   // Generated face size
+    const Vector4 *pixels;      // Source pixels data: panorama or cubemap faces
+    int sourceWidth;            // Source width: panorama width or cubemap face size
+    int sourceHeight;           // Source height: panorama height or cubemap faces height
+    Vector3 *coeffs;            // Irradiance spherical harmonics coefficients (9 per source row while projecting)
+    Vector4 **sourceMips;       // Prefilter source mip chain
+    int sourceLevels;           // Prefilter source mip chain levels
+    float alphaSqr;             // Prefilter GGX roughness alpha squared
+    int sampleCount;            // Prefilter samples per texel
+} CubemapGeneration;
+
+// Image mipmap level, generated from previous level [ImageMipmapsEx()]
+typedef struct ImageMipmapLevel {
+    const unsigned char *src;   // Previous level pixel data
+    int srcWidth;               // Previous level width
+    int srcHeight;              // Previous level height
+    unsigned char *dst;         // Generated level pixel data
+    int dstWidth;               // Generated level width
+    int dstHeight;              // Generated level height
+    int channels;               // Pixel channels, 8-bit per channel
+    int alphaIndex;             // Alpha channel index, -1 if no alpha
+    bool sRGB;                  // Color channels filtered in linear space
+} ImageMipmapLevel;
+
+// Image triangle fill, one span per row solved from edge functions [ImageDrawTriangle()]
+typedef struct ImageTriangleFill {
+    Image *dst;                 // Destination image
+    const unsigned char *pixel; // Pixel data, already converted to image format
+    int bytesPerPixel;          // Pixel data size
+    int xMin;                   // Bounding box left column
+    int xMax;                   // Bounding box right column
+    int yMin;                   // Bounding box top row
+    int wRows[3];               // Edge functions at (xMin, yMin)
+    int wXSteps[3];             // Edge functions increments per column
+    int wYSteps[3];             // Edge functions increments per row
+} ImageTriangleFill;
+
+// Image region filter, source rows inside region are box-filtered by scale
+typedef struct ImageRegionFilter {
+    int x, y;                   // Region position, clamped to image bounds
+    int width, height;          // Region size, clamped to image bounds
+    int scale;                  // Region scale down divider
+    int channels;               // Pixel channels (8 bit per channel)
+    int outWidth, outHeight;    // Resulting image size
+    int outY;                   // Resulting image next row
+    int rowCount;               // Region rows added
+    int rowsInCell;             // Rows accumulated in current row of cells
+    unsigned char *row;         // Current region row pixels, filled by decoder
+    unsigned int *rowSums;      // Current row of cells accumulated pixels
+    unsigned char *pixels;      // Resulting image pixels
+} ImageRegionFilter;
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// PNG region decoder, inflated data is unfiltered one row at a time
+typedef struct PNGRegionDecoder {
+    stbi__zbuf zbuf;            // Inflate state (stb_image zlib), output is a sliding window
+    unsigned char *window;      // Inflate output window
+    unsigned char *flushed;     // Inflate output window first byte not passed to rows
+    int colorType;              // PNG color type
+    int depth;                  // PNG bit depth
+    int sourceChannels;         // PNG channels per pixel (1 for palette)
+    int pixelBytes;             // Unfilter bytes per pixel (at least 1)
+    int rowSize;                // Filtered row size, including filter type byte
+    int rowFill;                // Current row bytes filled
+    int y;                      // Current row
+    unsigned char *rowData;     // Current row data
+    unsigned char *prevRowData; // Previous row data unfiltered (zeroed for first row)
+    unsigned char palette[256*4]; // Palette colors, tRNS alpha included
+    bool transparency;          // tRNS chunk available
+    unsigned short transparent[3]; // tRNS transparent color (no palette)
+    ImageRegionFilter filter;   // Region filter
+} PNGRegionDecoder;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -254,9 +514,76 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_QOI) || defined(SUPPORT_FILEFORMAT_PNG)
+static bool InitImageRegionFilter(ImageRegionFilter *filter, int width, int height, int channels, Rectangle region, int scale); // Init image region filter, region clamped to image bounds
+static void AddImageRegionRow(ImageRegionFilter *filter);           // Add region row pixels to image region filter
+static Image UnloadImageRegionFilter(ImageRegionFilter *filter);    // Unload image region filter, returns resulting image
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+static Image LoadImageRegionQOI(const unsigned char *fileData, int dataSize, Rectangle region, int scale); // Load image region from QOI data (streamed)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static Image LoadImageRegionPNG(const unsigned char *fileData, int dataSize, Rectangle region, int scale); // Load image region from PNG data (streamed)
+static bool InflatePNGRegion(PNGRegionDecoder *decoder);            // Inflate PNG image data, passing decoded data to rows
+static bool FlushPNGRegionWindow(PNGRegionDecoder *decoder);        // Pass inflated data to rows and slide inflate window
+static bool AddPNGRegionData(PNGRegionDecoder *decoder, const unsigned char *data, int size); // Add inflated data to PNG rows
+#endif
+static Image LoadImageRegionFull(const char *fileType, const unsigned char *fileData, int dataSize, Rectangle region, int scale); // Load image region decoding full image
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static int GetPixelDataFromColor(Color color, int format, unsigned char *pixel);    // Get color converted to pixel format data, returns bytes per pixel
+static void ImageFillSpan(Image *dst, int startX, int endX, int y, const unsigned char *pixel, int bytesPerPixel);  // Fill horizontal span with pixel data
+static void ImageDrawLinePixel(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, const unsigned char *pixel, int bytesPerPixel); // Draw line with pixel data
+static void FillImageRows(void *data, int start, int end);         // Copy first row into rows range, ImageProcessCallback
+static void FillImageTriangleRows(void *data, int start, int end); // Fill triangle spans on rows range, ImageProcessCallback
+static void GenImageMipmapLevel(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, int alphaIndex, bool sRGB); // Generate mipmap level from previous level (box filter)
+static void GenImageMipmapRows(void *data, int start, int end);    // Generate mipmap level rows range, ImageProcessCallback
+static float GetImageAlphaCoverage(const unsigned char *data, int pixelCount, int channels, int alphaIndex, float reference, float scale); // Get image alpha test coverage
+static void ScaleImageAlphaCoverage(unsigned char *data, int pixelCount, int channels, int alphaIndex, float reference, float coverage); // Scale image alpha to match alpha test coverage
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenImageGradientRadialRows(void *data, int start, int end);    // Generate radial gradient rows range, ImageProcessCallback
+static void GenImageGradientSquareRows(void *data, int start, int end);    // Generate square gradient rows range, ImageProcessCallback
+static void GenImagePerlinNoiseRows(void *data, int start, int end);       // Generate perlin noise rows range, ImageProcessCallback
+static void AddPerlinNoiseRow(float *values, const float *samplesX, int count, float frequency, float y, float z, unsigned char seed, float amplitude); // Add perlin noise octave to a row of values
+static void GenImageCellularRows(void *data, int start, int end);          // Generate cellular rows range, ImageProcessCallback
+static void GenCubemapPanoramaRows(void *data, int start, int end);        // Generate cubemap faces rows range from panorama, ImageProcessCallback
+static void ProjectCubemapIrradianceRows(void *data, int start, int end);  // Project cubemap faces rows range into spherical harmonics, ImageProcessCallback
+static void GenCubemapIrradianceRows(void *data, int start, int end);      // Generate irradiance cubemap faces rows range, ImageProcessCallback
+static void GenCubemapPrefilterRows(void *data, int start, int end);       // Generate prefiltered cubemap level faces rows range, ImageProcessCallback
+static Vector3 GetCubemapTexelDirection(int face, int x, int y, int size);      // Get normalized direction for a cubemap face texel center
+static Vector4 SampleCubemapNormalized(const Vector4 *faces, int size, Vector3 direction); // Sample cubemap faces data in a direction (bilinear)
+static void GetSphericalHarmonicsBasis(Vector3 direction, float *basis);       // Get spherical harmonics basis (9 coefficients) in a direction
+#endif
+static void GenImageCubemapMipmaps(Image *faces);                     // Generate cubemap faces mipmaps (vertical line layout), 6 faces per level
+static void LoadVirtualTexturePage(VirtualTexture texture, int page, int slot); // Load virtual texture page into cache slot
+static void UpdateVirtualTextureIndirection(VirtualTexture texture);   // Update virtual texture indirection table (RAM)
+static int CompareVirtualTexturePages(const void *a, const void *b);   // Compare virtual texture pages for sorting, coarser levels first
+
+static void ProcessImageItems(ImageProcessCallback process, void *data, int count, int itemWork); // Process items range, split between threads [SUPPORT_IMAGE_THREADS]
+#if defined(SUPPORT_IMAGE_THREADS)
+static void *ProcessImageBatch(void *batch);                        // Process image items range, thread entry point
+static void *DecodeTextureBatchImages(void *data);                  // Decode textures batch pending files, thread entry point
+#endif
+
+static void RotatePixelData(const void *srcData, void *dstData, int width, int height, int bytesPerPixel, bool clockwise); // Rotate pixel data 90 degrees, using tiles
+static void RotateImageTileRows(void *data, int start, int end);   // Rotate source tile rows range 90 degrees, ImageProcessCallback
+static void RotateImageRows(void *data, int start, int end);       // Rotate destination rows range any angle (bilinear), ImageProcessCallback
+
+static SkylinePacker *LoadSkylinePacker(int width, int height);     // Load skyline rectangles packer
+static void UnloadSkylinePacker(SkylinePacker *packer);             // Unload skyline rectangles packer
+static void ResetSkylinePacker(SkylinePacker *packer);              // Reset skyline packer (empty packing area)
+static bool PackSkylineRec(SkylinePacker *packer, int width, int height, int *x, int *y); // Pack rectangle into skyline
+static bool PackTextureAtlasRec(rAtlasData *data, int width, int height, int *x, int *y); // Pack rectangle into atlas, free rectangles first, then skyline
+static void ReleaseTextureAtlasRec(rAtlasData *data, int id);       // Release region space, pixels cleared and space added to free rectangles
+static void UploadTextureAtlasRec(TextureAtlas atlas, Rectangle rec); // Upload region pixels to GPU, with padding border
+static bool EvictTextureAtlasRegion(TextureAtlas atlas);            // Evict least recently used region from texture atlas
+
+static void CompressPixelBlocks(const unsigned char *pixels, int width, int height, int format, unsigned char *output); // Compress RGBA pixel data into block compressed format
+static void EncodeBlockBC1(const unsigned char *block, unsigned char *output, bool alphaMode);  // Encode 4x4 RGBA block into BC1 (DXT1) color block
+static void EncodeBlockAlphaBC3(const unsigned char *block, unsigned char *output);             // Encode 4x4 RGBA block alpha into BC3 (DXT5) alpha block
+static void EncodeBlockETC1(const unsigned char *block, unsigned char *output);                 // Encode 4x4 RGBA block into ETC1 block
+static void EncodeBlockAlphaEAC(const unsigned char *block, unsigned char *output);             // Encode 4x4 RGBA block alpha into EAC alpha block
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -552,6 +879,70 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     return image;
 }
 
+// Load image region from file into CPU memory (RAM), optionally scaled down
+// NOTE: Use a region with zero width or height to load the full image
+Image LoadImageRegion(const char *fileName, Rectangle region, int scale)
+{
+    Image image = { 0 };
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    // Loading image region from memory data
+    if (fileData != NULL)
+    {
+        image = LoadImageRegionFromMemory(GetFileExtension(fileName), fileData, dataSize, region, scale);
+
+        UnloadFileData(fileData);
+    }
+
+    return image;
+}
+
+// Load image region from memory buffer, scale divides region size: 1, 2, 4 or 8
+// NOTE: QOI and PNG data are decoded as a stream and only the requested region is kept in memory,
+// other file formats are fully decoded and then cropped and scaled down, as long as
+// image size is not over IMAGE_REGION_MAX_DECODE_PIXELS (e.g. JPEG, no scaled down decoding available)
+Image LoadImageRegionFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, Rectangle region, int scale)
+{
+    Image image = { 0 };
+
+    if ((fileData == NULL) || (dataSize == 0) || (fileType == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Invalid file data or extension");
+        return image;
+    }
+
+    if ((scale != 1) && (scale != 2) && (scale != 4) && (scale != 8))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Region scale not supported (%i), use 1, 2, 4 or 8", scale);
+        return image;
+    }
+
+    if ((false)
+#if defined(SUPPORT_FILEFORMAT_QOI)
+        || (strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        || (strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0)
+#endif
+        )
+    {
+#if defined(SUPPORT_FILEFORMAT_QOI)
+        if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0)) image = LoadImageRegionQOI(fileData, dataSize, region, scale);
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+        if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0)) image = LoadImageRegionPNG(fileData, dataSize, region, scale);
+#endif
+        if (image.data != NULL) TRACELOG(LOG_INFO, "IMAGE: Data region loaded successfully (%ix%i | %s | %i mipmaps)", image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
+        else TRACELOG(LOG_WARNING, "IMAGE: Failed to load image data region");
+    }
+    else image = LoadImageRegionFull(fileType, fileData, dataSize, region, scale);
+
+    return image;
+}
+
 // Load image from GPU texture data
 // NOTE: Compressed texture formats not supported
 Image LoadImageFromTexture(Texture2D texture)
@@ -668,10 +1059,8 @@ bool ExportImage(Image image, const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_QOI)
     else if (IsFileExtension(fileName, ".qoi"))
     {
-        channels = 0;
-        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
+        // NOTE: Other pixel formats have been already converted to RGBA 32bit
+        if ((channels == 1) || (channels == 2)) TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
 
         if ((channels == 3) || (channels == 4))
         {
@@ -718,24 +1107,73 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 
 #if defined(SUPPORT_IMAGE_EXPORT)
     int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
 
     if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
+    {
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageColors(image);
+        allocatedData = true;
+    }
 
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, dataSize);
+    }
+#else
+    if (false) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    else if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0))
+    {
+        // NOTE: RGB/RGBA image data is encoded directly, no intermediate copy required
+        if ((channels == 3) || (channels == 4))
+        {
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
+
+            fileData = (unsigned char *)qoi_encode(imgData, &desc, dataSize);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
     }
 #endif
 
+    if (allocatedData) RL_FREE(imgData);
 #endif
 
     return fileData;
 }
 
+// Set PNG compression level for image export: 0 (fastest) to 9 (best compression), default level is 8
+// NOTE 1: Level mapping depends on deflate compressor:
+//  - SUPPORT_COMPRESSION_API: level 0 stores data uncompressed, levels [1..9] map to sdefl levels [1..5]
+//  - stbiw zlib compressor: levels below 5 compress as level 5, there is no store mode
+// NOTE 2: Levels below 4 use a fixed rows filter, skipping the per-row filter selection heuristic
+// NOTE 3: Deflate runs on a single thread, sdefl closes and byte-aligns every stream it writes,
+// so independently compressed chunks can not be joined into one zlib stream as required by PNG
+void SetImageExportCompression(int level)
+{
+#if defined(SUPPORT_IMAGE_EXPORT)
+    if (level < 0) level = 0;
+    if (level > 9) level = 9;
+
+    stbi_write_png_compression_level = level;
+
+    if (level == 0) stbi_write_force_png_filter = 0;        // Filter: None, no compression applied anyway
+    else if (level < 4) stbi_write_force_png_filter = 2;    // Filter: Up, cheap and usually effective
+    else stbi_write_force_png_filter = -1;                  // Filter: Selected per row (min sum of absolute differences)
+#endif
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool ExportImageAsCode(Image image, const char *fileName)
 {
@@ -869,27 +1307,9 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
 Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
-
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
-
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    ImageGeneration generation = { pixels, width, height, inner, outer, density };
+    ProcessImageItems(GenImageGradientRadialRows, &generation, height, width);
 
     Image image = {
         .data = pixels,
@@ -908,37 +1328,15 @@ Image GenImageGradientSquare(int width, int height, float density, Color inner,
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
     float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
-
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
 
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
+    // Normalized horizontal distances are the same for every row, computed once
+    float *normalizedDistX = (float *)RL_MALLOC(width*sizeof(float));
+    for (int x = 0; x < width; x++) normalizedDistX[x] = fabsf(x - centerX)/centerX;
 
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+    ImageGeneration generation = { pixels, width, height, inner, outer, density, normalizedDistX };
+    ProcessImageItems(GenImageGradientSquareRows, &generation, height, width);
 
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    RL_FREE(normalizedDistX);
 
     Image image = {
         .data = pixels,
@@ -1006,38 +1404,23 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 
     float aspectRatio = (float)width/(float)height;
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
+    float *samplesX = (float *)RL_MALLOC(width*sizeof(float));
 
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+    // Horizontal sample positions are the same for every row, computed once
+    for (int x = 0; x < width; x++)
+    {
+        samplesX[x] = (float)(x + offsetX)*(scale/(float)width);
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+        // Apply aspect ratio compensation to wider side
+        if (width > height) samplesX[x] *= aspectRatio;
+    }
 
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
+    ImageGeneration generation = { pixels, width, height, BLANK, BLANK, 0.0f, samplesX, offsetY, scale };
 
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    // NOTE: Every pixel evaluates 6 noise octaves
+    ProcessImageItems(GenImagePerlinNoiseRows, &generation, height, width*6);
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    RL_FREE(samplesX);
 
     Image image = {
         .data = pixels,
@@ -1059,48 +1442,19 @@ Image GenImageCellular(int width, int height, int tileSize)
     int seedsPerCol = height/tileSize;
     int seedCount = seedsPerRow*seedsPerCol;
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+    // Seeds positions as integer pairs (x, y)
+    int *seeds = (int *)RL_MALLOC(seedCount*2*sizeof(int));
 
     for (int i = 0; i < seedCount; i++)
     {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
+        seeds[i*2 + 1] = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i*2] = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    // NOTE: Seeds are generated first on calling thread, so output does not depend on threads,
+    // every pixel is compared with up to 9 seeds
+    ImageGeneration generation = { pixels, width, height, BLANK, BLANK, 0.0f, NULL, 0, 0.0f, seeds, tileSize };
+    ProcessImageItems(GenImageCellularRows, &generation, height, width*9);
 
     RL_FREE(seeds);
 
@@ -1133,77 +1487,250 @@ Image GenImageText(int width, int height, const char *text)
 
     return image;
 }
-#endif      // SUPPORT_IMAGE_GENERATION
 
-//------------------------------------------------------------------------------------
-// Image manipulation functions
-//------------------------------------------------------------------------------------
-// Copy an image to a new image
-Image ImageCopy(Image image)
+// Generate cubemap image from equirectangular panorama image
+// NOTE: Resulting faces follow CUBEMAP_LAYOUT_LINE_VERTICAL layout (+X, -X, +Y, -Y, +Z, -Z), with same format as panorama,
+// panorama top row is expected to be up direction (+Y), panorama is sampled with bilinear filtering
+Image GenImageCubemapPanorama(Image panorama, int size)
 {
-    Image newImage = { 0 };
+    Image cubemap = { 0 };
 
-    int width = image.width;
-    int height = image.height;
-    int size = 0;
-
-    for (int i = 0; i < image.mipmaps; i++)
+    if ((panorama.data == NULL) || (panorama.width == 0) || (panorama.height == 0) || (size <= 0) || (panorama.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        size += GetPixelDataSize(width, height, image.format);
-
-        width /= 2;
-        height /= 2;
-
-        // Security check for NPOT textures
-        if (width < 1) width = 1;
-        if (height < 1) height = 1;
+        TRACELOG(LOG_WARNING, "IMAGE: Cubemap panorama parameters not valid, compressed formats not supported");
+        return cubemap;
     }
 
-    newImage.data = RL_CALLOC(size, 1);
+    Vector4 *pixels = LoadImageDataNormalized(panorama);
+    Vector4 *faces = (Vector4 *)RL_MALLOC((size_t)size*size*6*sizeof(Vector4));
 
-    if (newImage.data != NULL)
-    {
-        // NOTE: Size must be provided in bytes
-        memcpy(newImage.data, image.data, size);
+    // Faces rows are independent, they can be split between threads
+    CubemapGeneration generation = { faces, size, pixels, panorama.width, panorama.height };
+    ProcessImageItems(GenCubemapPanoramaRows, &generation, size*6, size);
 
-        newImage.width = image.width;
-        newImage.height = image.height;
-        newImage.mipmaps = image.mipmaps;
-        newImage.format = image.format;
-    }
+    RL_FREE(pixels);
 
-    return newImage;
+    cubemap = (Image){ faces, size, size*6, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 };
+    ImageFormat(&cubemap, panorama.format);
+
+    return cubemap;
 }
 
-// Create an image from another image piece
-Image ImageFromImage(Image image, Rectangle rec)
+// Generate diffuse irradiance cubemap image from cubemap image (CUBEMAP_LAYOUT_LINE_VERTICAL)
+// NOTE: Radiance is projected into 9 spherical harmonics coefficients, cosine convolution is evaluated per texel,
+// result is irradiance divided by PI (a white environment results in white irradiance)
+Image GenImageCubemapIrradiance(Image cubemap, int size)
 {
-    Image result = { 0 };
+    Image irradiance = { 0 };
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    if ((cubemap.data == NULL) || (cubemap.height != cubemap.width*6) || (size <= 0) || (cubemap.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Cubemap irradiance requires a vertical line layout cubemap, compressed formats not supported");
+        return irradiance;
+    }
 
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
+    int sourceSize = cubemap.width;
+    Vector4 *pixels = LoadImageDataNormalized(cubemap);
+    Vector3 coeffs[9] = { 0 };
 
-    for (int y = 0; y < (int)rec.height; y++)
+    // Project radiance into spherical harmonics, rows projected separately (in parallel) and added in order,
+    // so result does not depend on threads count
+    Vector3 *rowCoeffs = (Vector3 *)RL_CALLOC((size_t)sourceSize*6*9, sizeof(Vector3));
+    CubemapGeneration projection = { NULL, 0, pixels, sourceSize, sourceSize*6, rowCoeffs };
+    ProcessImageItems(ProjectCubemapIrradianceRows, &projection, sourceSize*6, sourceSize*9);
+
+    for (int row = 0; row < sourceSize*6; row++)
     {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
+        for (int i = 0; i < 9; i++)
+        {
+            coeffs[i].x += rowCoeffs[row*9 + i].x;
+            coeffs[i].y += rowCoeffs[row*9 + i].y;
+            coeffs[i].z += rowCoeffs[row*9 + i].z;
+        }
     }
 
-    return result;
+    RL_FREE(rowCoeffs);
+    RL_FREE(pixels);
+
+    // Cosine lobe convolution per band (divided by PI): 1, 2/3, 1/4
+    for (int i = 0; i < 9; i++)
+    {
+        float band = (i == 0)? 1.0f : ((i < 4)? 2.0f/3.0f : 0.25f);
+        coeffs[i].x *= band;
+        coeffs[i].y *= band;
+        coeffs[i].z *= band;
+    }
+
+    Vector4 *faces = (Vector4 *)RL_MALLOC((size_t)size*size*6*sizeof(Vector4));
+
+    CubemapGeneration generation = { faces, size, NULL, 0, 0, coeffs };
+    ProcessImageItems(GenCubemapIrradianceRows, &generation, size*6, size*9);
+
+    irradiance = (Image){ faces, size, size*6, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 };
+    ImageFormat(&irradiance, cubemap.format);
+
+    return irradiance;
 }
 
-// Crop an image to area defined by a rectangle
-// NOTE: Security checks are performed in case rectangle goes out of bounds
-void ImageCrop(Image *image, Rectangle crop)
+// Generate specular prefiltered cubemap image from cubemap image (CUBEMAP_LAYOUT_LINE_VERTICAL)
+// NOTE: Every mipmap level is filtered with GGX distribution, roughness increases linearly from 0.0f (base level) to 1.0f (last level),
+// samples are taken from a box-filtered source mip chain according to their solid angle to avoid aliasing
+Image GenImageCubemapPrefilter(Image cubemap, int size, int mipmaps)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    Image prefilter = { 0 };
 
-    // Security checks to validate crop rectangle
+    if ((cubemap.data == NULL) || (cubemap.height != cubemap.width*6) || (size <= 0) || (mipmaps <= 0) || (cubemap.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Cubemap prefilter requires a vertical line layout cubemap, compressed formats not supported");
+        return prefilter;
+    }
+
+    // Limit mipmaps to available levels
+    int maxMipmaps = 1;
+    while ((size >> maxMipmaps) > 0) maxMipmaps++;
+    mipmaps = MIN(mipmaps, maxMipmaps);
+
+    // Source mip chain, faces of every level are stored one after the other
+    int sourceSize = cubemap.width;
+    int sourceLevels = 1;
+    while ((sourceSize >> sourceLevels) > 0) sourceLevels++;
+
+    Vector4 **sourceMips = (Vector4 **)RL_MALLOC(sourceLevels*sizeof(Vector4 *));
+    sourceMips[0] = LoadImageDataNormalized(cubemap);
+
+    for (int level = 1; level < sourceLevels; level++)
+    {
+        int levelSize = sourceSize >> level;
+        int prevSize = sourceSize >> (level - 1);
+        sourceMips[level] = (Vector4 *)RL_MALLOC((size_t)levelSize*levelSize*6*sizeof(Vector4));
+
+        for (int face = 0; face < 6; face++)
+        {
+            const Vector4 *src = sourceMips[level - 1] + (size_t)face*prevSize*prevSize;
+            Vector4 *dst = sourceMips[level] + (size_t)face*levelSize*levelSize;
+
+            for (int y = 0; y < levelSize; y++)
+            {
+                for (int x = 0; x < levelSize; x++)
+                {
+                    Vector4 c0 = src[(2*y)*prevSize + 2*x];
+                    Vector4 c1 = src[(2*y)*prevSize + 2*x + 1];
+                    Vector4 c2 = src[(2*y + 1)*prevSize + 2*x];
+                    Vector4 c3 = src[(2*y + 1)*prevSize + 2*x + 1];
+
+                    dst[y*levelSize + x] = (Vector4){ (c0.x + c1.x + c2.x + c3.x)*0.25f, (c0.y + c1.y + c2.y + c3.y)*0.25f,
+                        (c0.z + c1.z + c2.z + c3.z)*0.25f, (c0.w + c1.w + c2.w + c3.w)*0.25f };
+                }
+            }
+        }
+    }
+
+    int dataSize = 0;
+    for (int level = 0; level < mipmaps; level++) dataSize += GetPixelDataSize(MAX(size >> level, 1), MAX(size >> level, 1)*6, cubemap.format);
+
+    prefilter = (Image){ RL_MALLOC(dataSize), size, size*6, mipmaps, cubemap.format };
+
+    unsigned char *levelData = (unsigned char *)prefilter.data;
+
+    for (int level = 0; level < mipmaps; level++)
+    {
+        int levelSize = MAX(size >> level, 1);
+        float roughness = (mipmaps > 1)? (float)level/(mipmaps - 1) : 0.0f;
+        float alpha = roughness*roughness;
+        float alphaSqr = alpha*alpha;
+        int sampleCount = (level == 0)? 1 : CUBEMAP_PREFILTER_SAMPLES;
+
+        Vector4 *faces = (Vector4 *)RL_MALLOC((size_t)levelSize*levelSize*6*sizeof(Vector4));
+
+        CubemapGeneration generation = { faces, levelSize, NULL, sourceSize, 0, NULL, sourceMips, sourceLevels, alphaSqr, sampleCount };
+        ProcessImageItems(GenCubemapPrefilterRows, &generation, levelSize*6, levelSize*sampleCount);
+
+        Image levelImage = { faces, levelSize, levelSize*6, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 };
+        ImageFormat(&levelImage, cubemap.format);
+
+        int levelDataSize = GetPixelDataSize(levelSize, levelSize*6, cubemap.format);
+        memcpy(levelData, levelImage.data, levelDataSize);
+        levelData += levelDataSize;
+
+        UnloadImage(levelImage);
+    }
+
+    for (int level = 0; level < sourceLevels; level++) RL_FREE(sourceMips[level]);
+    RL_FREE(sourceMips);
+
+    return prefilter;
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+//------------------------------------------------------------------------------------
+// Image manipulation functions
+//------------------------------------------------------------------------------------
+// Copy an image to a new image
+Image ImageCopy(Image image)
+{
+    Image newImage = { 0 };
+
+    int width = image.width;
+    int height = image.height;
+    int size = 0;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+
+        width /= 2;
+        height /= 2;
+
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    newImage.data = RL_CALLOC(size, 1);
+
+    if (newImage.data != NULL)
+    {
+        // NOTE: Size must be provided in bytes
+        memcpy(newImage.data, image.data, size);
+
+        newImage.width = image.width;
+        newImage.height = image.height;
+        newImage.mipmaps = image.mipmaps;
+        newImage.format = image.format;
+    }
+
+    return newImage;
+}
+
+// Create an image from another image piece
+Image ImageFromImage(Image image, Rectangle rec)
+{
+    Image result = { 0 };
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+
+    result.width = (int)rec.width;
+    result.height = (int)rec.height;
+    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
+    result.format = image.format;
+    result.mipmaps = 1;
+
+    for (int y = 0; y < (int)rec.height; y++)
+    {
+        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
+    }
+
+    return result;
+}
+
+// Crop an image to area defined by a rectangle
+// NOTE: Security checks are performed in case rectangle goes out of bounds
+void ImageCrop(Image *image, Rectangle crop)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    // Security checks to validate crop rectangle
     if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
     if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
     if ((crop.x + crop.width) > image->width) crop.width = image->width - crop.x;
@@ -1452,6 +1979,51 @@ void ImageFormat(Image *image, int newFormat)
             #endif
             }
         }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+        {
+            // Block compression encoders work on 4x4 blocks of RGBA 32bit pixel data
+            if (((image->width%4) != 0) || ((image->height%4) != 0)) TRACELOG(LOG_WARNING, "IMAGE: Block compression requires image size multiple of 4");
+            else
+            {
+                Image pixels = ImageCopy(*image);
+                ImageFormat(&pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);   // Mipmaps regenerated if required
+
+                // NOTE: Only mipmap levels with size multiple of 4 are kept
+                int mipmaps = 0;
+                int dataSize = 0;
+
+                for (int i = 0, mipWidth = pixels.width, mipHeight = pixels.height; i < pixels.mipmaps; i++)
+                {
+                    if (((mipWidth%4) != 0) || ((mipHeight%4) != 0)) break;
+
+                    dataSize += GetPixelDataSize(mipWidth, mipHeight, newFormat);
+                    mipmaps++;
+                    mipWidth /= 2;
+                    mipHeight /= 2;
+                }
+
+                unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+                unsigned char *srcLevel = (unsigned char *)pixels.data;
+                unsigned char *dstLevel = data;
+
+                for (int i = 0, mipWidth = pixels.width, mipHeight = pixels.height; i < mipmaps; i++)
+                {
+                    CompressPixelBlocks(srcLevel, mipWidth, mipHeight, newFormat, dstLevel);
+
+                    srcLevel += GetPixelDataSize(mipWidth, mipHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+                    dstLevel += GetPixelDataSize(mipWidth, mipHeight, newFormat);
+                    mipWidth /= 2;
+                    mipHeight /= 2;
+                }
+
+                UnloadImage(pixels);
+
+                RL_FREE(image->data);
+                image->data = data;
+                image->format = newFormat;
+                image->mipmaps = mipmaps;
+            }
+        }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
@@ -1490,6 +2062,8 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
     // Create image to store text
     imText = GenImageColor((int)imSize.x, (int)imSize.y, BLANK);
 
+    int previous = 0;               // Previous codepoint for kerning, 0 after spaces and line breaks
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1503,14 +2077,19 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
             // TODO: Support custom line spacing defined by user
             textOffsetY += (font.baseSize + font.baseSize/2);
             textOffsetX = 0;
+            previous = 0;
         }
         else
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
+                textOffsetX += (int)roundf(GetGlyphKerning(font, previous, codepoint));   // WARNING: Module required: rtext
+                previous = codepoint;
+
                 Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
                 ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
             }
+            else previous = 0;
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
             else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
@@ -2366,6 +2945,14 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
 void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, false, 0.0f);
+}
+
+// Generate all mipmap levels for a provided image, with optional sRGB filtering and alpha coverage preservation
+// NOTE 1: Every level is filtered from previous one, 8-bit per channel formats use a 2x2 box filter written directly into image data
+// NOTE 2: alphaCoverage is the alpha test reference value [0.0f..1.0f] to preserve coverage for, 0.0f to disable
+void ImageMipmapsEx(Image *image, bool sRGB, float alphaCoverage)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2396,18 +2983,47 @@ void ImageMipmaps(Image *image)
         void *temp = RL_REALLOC(image->data, mipSize);
 
         if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        // Channels and alpha channel index for 8-bit per channel formats, filtered directly
+        int channels = 0;
+        int alphaIndex = -1;
+
+        switch (image->format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; alphaIndex = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; alphaIndex = 3; break;
+            default: break;
+        }
+
+        if ((channels == 0) && (sRGB || (alphaCoverage > 0.0f))) TRACELOG(LOG_WARNING, "IMAGE: Mipmaps sRGB filtering and alpha coverage only supported for 8-bit per channel formats");
+
+        // Alpha test coverage of base level, preserved on every generated level
+        float baseCoverage = 0.0f;
+        if ((alphaIndex >= 0) && (alphaCoverage > 0.0f)) baseCoverage = GetImageAlphaCoverage(image->data, image->width*image->height, channels, alphaIndex, alphaCoverage, 1.0f);
 
         // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *prevmip = NULL;
         unsigned char *nextmip = image->data;
 
         mipWidth = image->width;
         mipHeight = image->height;
         mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+        Image imCopy = { 0 };
+        if (channels == 0) imCopy = ImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
         {
+            int prevWidth = mipWidth;
+            int prevHeight = mipHeight;
+
+            prevmip = nextmip;
             nextmip += mipSize;
 
             mipWidth /= 2;
@@ -2423,9 +3039,18 @@ void ImageMipmaps(Image *image)
 
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+            if (channels > 0)
+            {
+                GenImageMipmapLevel(prevmip, prevWidth, prevHeight, nextmip, mipWidth, mipHeight, channels, alphaIndex, sRGB);
+
+                if (baseCoverage > 0.0f) ScaleImageAlphaCoverage(nextmip, mipWidth*mipHeight, channels, alphaIndex, alphaCoverage, baseCoverage);
+            }
+            else
+            {
+                ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
 
-            memcpy(nextmip, imCopy.data, mipSize);
+                memcpy(nextmip, imCopy.data, mipSize);
+            }
         }
 
         UnloadImage(imCopy);
@@ -2548,6 +3173,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 }
 
 // Flip image vertically
+// NOTE: Rows are swapped in-place
 void ImageFlipVertical(Image *image)
 {
     // Security check to avoid program crash
@@ -2557,21 +3183,25 @@ void ImageFlipVertical(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        int bytesPerRow = image->width*GetPixelDataSize(1, 1, image->format);
+        unsigned char *rowData = (unsigned char *)RL_MALLOC(bytesPerRow);
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        for (int y = 0; y < image->height/2; y++)
         {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
+            unsigned char *topRow = (unsigned char *)image->data + (size_t)y*bytesPerRow;
+            unsigned char *bottomRow = (unsigned char *)image->data + (size_t)(image->height - 1 - y)*bytesPerRow;
+
+            memcpy(rowData, topRow, bytesPerRow);
+            memcpy(topRow, bottomRow, bytesPerRow);
+            memcpy(bottomRow, rowData, bytesPerRow);
         }
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        RL_FREE(rowData);
     }
 }
 
 // Flip image horizontally
+// NOTE: Pixels are swapped in-place, row by row
 void ImageFlipHorizontal(Image *image)
 {
     // Security check to avoid program crash
@@ -2582,41 +3212,50 @@ void ImageFlipHorizontal(Image *image)
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        unsigned char pixel[16] = { 0 };
 
         for (int y = 0; y < image->height; y++)
         {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
+            unsigned char *left = (unsigned char *)image->data + (size_t)y*image->width*bytesPerPixel;
+            unsigned char *right = left + (image->width - 1)*bytesPerPixel;
 
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
+            switch (bytesPerPixel)
             {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
+                case 1: for (; left < right; left++, right--) { unsigned char temp = *left; *left = *right; *right = temp; } break;
+                case 2:
+                {
+                    for (; left < right; left += 2, right -= 2)
+                    {
+                        unsigned short a, b;
+                        memcpy(&a, left, 2); memcpy(&b, right, 2);
+                        memcpy(left, &b, 2); memcpy(right, &a, 2);
+                    }
+                } break;
+                case 4:
+                {
+                    for (; left < right; left += 4, right -= 4)
+                    {
+                        unsigned int a, b;
+                        memcpy(&a, left, 4); memcpy(&b, right, 4);
+                        memcpy(left, &b, 4); memcpy(right, &a, 4);
+                    }
+                } break;
+                default:
+                {
+                    for (; left < right; left += bytesPerPixel, right -= bytesPerPixel)
+                    {
+                        memcpy(pixel, left, bytesPerPixel);
+                        memcpy(left, right, bytesPerPixel);
+                        memcpy(right, pixel, bytesPerPixel);
+                    }
+                } break;
             }
         }
-        */
     }
 }
 
 // Rotate image in degrees
+// NOTE: Multiples of 90 degrees are rotated exactly (no filtering), other angles use bilinear filtering
 void ImageRotate(Image *image, int degrees)
 {
     // Security check to avoid program crash
@@ -2624,6 +3263,16 @@ void ImageRotate(Image *image, int degrees)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else if ((degrees%90) == 0)
+    {
+        switch (((degrees%360) + 360)%360)
+        {
+            case 90: ImageRotateCW(image); break;
+            case 180: ImageFlipVertical(image); ImageFlipHorizontal(image); break;
+            case 270: ImageRotateCCW(image); break;
+            default: break;
+        }
+    }
     else
     {
         float rad = degrees*PI/180.0f;
@@ -2636,37 +3285,10 @@ void ImageRotate(Image *image, int degrees)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
 
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
-
-                    float px = oldX - x1;
-                    float py = oldY - y1;
-
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
-
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
-
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
-        }
+        // Destination rows are independent, they can be split between threads
+        ImageRotation rotation = { (const unsigned char *)image->data, rotatedData, image->width, image->height,
+            width, height, bytesPerPixel, false, sinRadius, cosRadius };
+        ProcessImageItems(RotateImageRows, &rotation, height, width);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2688,14 +3310,7 @@ void ImageRotateCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+        RotatePixelData(image->data, rotatedData, image->width, image->height, bytesPerPixel, true);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2720,14 +3335,7 @@ void ImageRotateCCW(Image *image)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+        RotatePixelData(image->data, rotatedData, image->width, image->height, bytesPerPixel, false);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -3322,17 +3930,16 @@ void ImageClearBackground(Image *dst, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    // Convert color to image format just once
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Fill first row and repeat it for all other rows
+    ImageFillSpan(dst, 0, dst->width - 1, 0, pixel, bytesPerPixel);
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
-    {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    ImageRowsFill fill = { (unsigned char *)dst->data, (size_t)dst->width*bytesPerPixel, dst->width*bytesPerPixel };
+    ProcessImageItems(FillImageRows, &fill, dst->height - 1, dst->width);
 }
 
 // Draw pixel within an image
@@ -3485,54 +4092,14 @@ void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 // Draw line within an image
 void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
-    // Calculate differences in coordinates
-    int shortLen = endPosY - startPosY;
-    int longLen = endPosX - startPosX;
-    bool yLonger = false;
-
-    // Determine if the line is more vertical than horizontal
-    if (abs(shortLen) > abs(longLen))
-    {
-        // Swap the lengths if the line is more vertical
-        int temp = shortLen;
-        shortLen = longLen;
-        longLen = temp;
-        yLonger = true;
-    }
-
-    // Initialize variables for drawing loop
-    int endVal = longLen;
-    int sgnInc = 1;
-
-    // Adjust direction increment based on longLen sign
-    if (longLen < 0)
-    {
-        longLen = -longLen;
-        sgnInc = -1;
-    }
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Calculate fixed-point increment for shorter length
-    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
+    // Convert color to image format just once
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
 
-    // Draw the line pixel by pixel
-    if (yLonger)
-    {
-        // If line is more vertical, iterate over y-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
-        }
-    }
-    else
-    {
-        // If line is more horizontal, iterate over x-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
-        }
-    }
+    if (bytesPerPixel > 0) ImageDrawLinePixel(dst, startPosX, startPosY, endPosX, endPosY, pixel, bytesPerPixel);
 }
 
 // Draw line within an image (Vector version)
@@ -3561,8 +4128,16 @@ void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color co
     int dx = x2 - x1;
     int dy = y2 - y1;
 
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // Convert color to image format just once, shared by all the lines
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
     // Draw the main line between (x1, y1) and (x2, y2)
-    ImageDrawLine(dst, x1, y1, x2, y2, color);
+    ImageDrawLinePixel(dst, x1, y1, x2, y2, pixel, bytesPerPixel);
 
     // Determine if the line is more horizontal or vertical
     if ((dx != 0) && (abs(dy/dx) < 1))
@@ -3574,8 +4149,8 @@ void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color co
         // Draw additional lines above and below the main line
         for (int i = 1; i <= wy; i++)
         {
-            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color); // Draw above the main line
-            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color); // Draw below the main line
+            ImageDrawLinePixel(dst, x1, y1 - i, x2, y2 - i, pixel, bytesPerPixel); // Draw above the main line
+            ImageDrawLinePixel(dst, x1, y1 + i, x2, y2 + i, pixel, bytesPerPixel); // Draw below the main line
         }
     }
     else if (dy != 0)
@@ -3587,8 +4162,8 @@ void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color co
         // Draw additional lines to the left and right of the main line
         for (int i = 1; i <= wx; i++)
         {
-            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color); // Draw left of the main line
-            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color); // Draw right of the main line
+            ImageDrawLinePixel(dst, x1 - i, y1, x2 - i, y2, pixel, bytesPerPixel); // Draw left of the main line
+            ImageDrawLinePixel(dst, x1 + i, y1, x2 + i, y2, pixel, bytesPerPixel); // Draw right of the main line
         }
     }
 }
@@ -3596,16 +4171,32 @@ void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color co
 // Draw circle within an image
 void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    // Convert color to image format just once
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
+    // NOTE: Every span covers [center - d, center + d - 1], a zero-length span still fills the center pixel
     while (y >= x)
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        // Rows at centerY +/- x are visited just once
+        ImageFillSpan(dst, centerX - y, centerX + ((y > 0)? y - 1 : 0), centerY + x, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerX + ((y > 0)? y - 1 : 0), centerY - x, pixel, bytesPerPixel);
+
+        // Rows at centerY +/- y only grow while y is kept, fill them when y is about to change
+        if ((decesionParameter > 0) || (y < (x + 1)))
+        {
+            ImageFillSpan(dst, centerX - x, centerX + ((x > 0)? x - 1 : 0), centerY + y, pixel, bytesPerPixel);
+            ImageFillSpan(dst, centerX - x, centerX + ((x > 0)? x - 1 : 0), centerY - y, pixel, bytesPerPixel);
+        }
+
         x++;
 
         if (decesionParameter > 0)
@@ -3692,26 +4283,19 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     int sy = (int)rec.y;
     int sx = (int)rec.x;
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Convert color to image format just once
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
 
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+    // Fill the first row (at least one pixel) with the pixel data
+    ImageFillSpan(dst, sx, sx + (((int)rec.width > 1)? (int)rec.width - 1 : 0), sy, pixel, bytesPerPixel);
 
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
-
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
-    {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    size_t bytesOffset = ((size_t)sy*dst->width + sx)*bytesPerPixel;
 
     // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
-    {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
-    }
+    ImageRowsFill fill = { (unsigned char *)dst->data + bytesOffset, (size_t)dst->width*bytesPerPixel, bytesPerPixel*(int)rec.width };
+    ProcessImageItems(FillImageRows, &fill, (int)rec.height - 1, (int)rec.width);
 }
 
 // Draw rectangle lines within an image
@@ -3763,31 +4347,21 @@ void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color col
     int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
     int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
-    {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    if (xMax >= dst->width) xMax = dst->width - 1;
+    if (yMax >= dst->height) yMax = dst->height - 1;
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is then we can draw the pixel with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
+    // Convert color to image format just once
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelDataFromColor(color, dst->format, pixel);
+    if (bytesPerPixel == 0) return;
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    // Rasterization, rows are independent so they can be split between threads
+    ImageTriangleFill fill = { dst, pixel, bytesPerPixel, xMin, xMax, yMin,
+        { w1Row, w2Row, w3Row }, { w1XStep, w2XStep, w3XStep }, { w1YStep, w2YStep, w3YStep } };
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
+    if (yMax >= yMin) ProcessImageItems(FillImageTriangleRows, &fill, yMax - yMin + 1, xMax - xMin + 1);
 }
 
 // Draw triangle with interpolated colors within an image
@@ -4147,6 +4721,10 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
             if ((image.height/6) == image.width) { layout = CUBEMAP_LAYOUT_LINE_VERTICAL; cubemap.width = image.height/6; }
             else if ((image.width/3) == (image.height/4)) { layout = CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR; cubemap.width = image.width/3; }
         }
+
+    #if defined(SUPPORT_IMAGE_GENERATION)
+        if ((layout == CUBEMAP_LAYOUT_AUTO_DETECT) && (image.width == image.height*2)) { layout = CUBEMAP_LAYOUT_PANORAMA; cubemap.width = image.width/4; }
+    #endif
     }
     else
     {
@@ -4154,6 +4732,7 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
         if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) cubemap.width = image.width/6;
         if (layout == CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR) cubemap.width = image.width/3;
         if (layout == CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE) cubemap.width = image.width/4;
+        if (layout == CUBEMAP_LAYOUT_PANORAMA) cubemap.width = image.width/4;
     }
 
     cubemap.height = cubemap.width;
@@ -4171,12 +4750,19 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
         if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
         {
             faces = ImageCopy(image);       // Image data already follows expected convention
+
+            // NOTE: Provided mipmaps are expected to store the 6 faces of every level one after the other,
+            // as generated by GenImageCubemapPrefilter(), levels count is limited by face size
+            int faceLevels = 1;
+            while ((size >> faceLevels) > 0) faceLevels++;
+            if (faces.mipmaps > faceLevels) faces.mipmaps = faceLevels;
         }
-        /*else if (layout == CUBEMAP_LAYOUT_PANORAMA)
+    #if defined(SUPPORT_IMAGE_GENERATION)
+        else if (layout == CUBEMAP_LAYOUT_PANORAMA)
         {
-            // TODO: implement panorama by converting image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
-        } */
+            faces = GenImageCubemapPanorama(image, size);   // Equirectangular panorama converted to square faces
+        }
+    #endif
         else
         {
             if (layout == CUBEMAP_LAYOUT_LINE_HORIZONTAL) for (int i = 0; i < 6; i++) faceRecs[i].x = (float)size*i;
@@ -4203,17 +4789,13 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
             faces = GenImageColor(size, size*6, MAGENTA);
             ImageFormat(&faces, image.format);
 
-            Image mipmapped = ImageCopy(image);
-        #if defined(SUPPORT_IMAGE_MANIPULATION)
-            ImageMipmaps(&mipmapped);
-            ImageMipmaps(&faces);
-        #endif
-
             // NOTE: Image formatting does not work with compressed textures
+            for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
 
-            for (int i = 0; i < 6; i++) ImageDraw(&faces, mipmapped, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
-
-            UnloadImage(mipmapped);
+        #if defined(SUPPORT_IMAGE_MANIPULATION)
+            // Mipmaps generated per face, once faces are filled
+            GenImageCubemapMipmaps(&faces);
+        #endif
         }
 
         // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
@@ -4223,7 +4805,7 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
         if (cubemap.id != 0)
         {
             cubemap.format = faces.format;
-            cubemap.mipmaps = 1;
+            cubemap.mipmaps = faces.mipmaps;
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
 
@@ -4345,1204 +4927,4503 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
 }
 
 //------------------------------------------------------------------------------------
-// Texture configuration functions
+// Texture batch loading functions
 //------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
+// Load textures batch from a list of files, textures are loaded progressively with UpdateTextureBatch()
+// NOTE: Textures are accessed by file index: batch.textures[i], id is 0 while pending or if loading failed,
+// with SUPPORT_IMAGE_THREADS files start decoding on worker threads immediately
+TextureBatch LoadTextureBatch(const char **fileNames, int count)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
-}
+    TextureBatch batch = { 0 };
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
-{
-    switch (filter)
+    if ((fileNames == NULL) || (count <= 0)) return batch;
+
+    batch.count = count;
+    batch.fileNames = (char **)RL_CALLOC(count, sizeof(char *));
+    batch.textures = (Texture2D *)RL_CALLOC(count, sizeof(Texture2D));
+
+    for (int i = 0; i < count; i++)
     {
-        case TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+        int length = (int)strlen(fileNames[i]);
+        batch.fileNames[i] = (char *)RL_MALLOC(length + 1);
+        memcpy(batch.fileNames[i], fileNames[i], length + 1);
+    }
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+    rTextureBatchData *data = (rTextureBatchData *)RL_CALLOC(1, sizeof(rTextureBatchData));
+    data->count = count;
+    data->fileNames = batch.fileNames;
+    data->images = (Image *)RL_CALLOC(count, sizeof(Image));
+    data->states = (unsigned char *)RL_CALLOC(count, sizeof(unsigned char));
+    batch.data = data;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+#if defined(SUPPORT_IMAGE_THREADS)
+    int threadCount = (count < TEXTURE_BATCH_MAX_THREADS)? count : TEXTURE_BATCH_MAX_THREADS;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+    if (pthread_mutex_init(&data->mutex, NULL) == 0)
+    {
+        // NOTE: If no thread can be created, files are decoded on UpdateTextureBatch()
+        for (int i = 0; i < threadCount; i++)
+        {
+            if (pthread_create(&data->threads[data->threadCount], NULL, DecodeTextureBatchImages, data) == 0) data->threadCount++;
+        }
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+        if (data->threadCount == 0) pthread_mutex_destroy(&data->mutex);
     }
+#endif
+
+    return batch;
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrap)
+// Unload textures batch, loaded textures are also unloaded from GPU memory (VRAM)
+// NOTE: Files decoding still in progress is cancelled
+void UnloadTextureBatch(TextureBatch batch)
 {
-    switch (wrap)
+    rTextureBatchData *data = batch.data;
+
+    if (data != NULL)
     {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
+#if defined(SUPPORT_IMAGE_THREADS)
+        if (data->threadCount > 0)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
+            pthread_mutex_lock(&data->mutex);
+            data->cancel = true;
+            pthread_mutex_unlock(&data->mutex);
+
+            for (int i = 0; i < data->threadCount; i++) pthread_join(data->threads[i], NULL);
+            pthread_mutex_destroy(&data->mutex);
+        }
+#endif
+        for (int i = 0; i < data->count; i++)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+            if (data->states[i] == TEXTURE_BATCH_FILE_DECODED) UnloadImage(data->images[i]);
+        }
+
+        RL_FREE(data->images);
+        RL_FREE(data->states);
+        RL_FREE(data);
     }
-}
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a texture
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
-{
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
-}
+    for (int i = 0; i < batch.count; i++)
+    {
+        if (batch.textures[i].id > 0) UnloadTexture(batch.textures[i]);
+        RL_FREE(batch.fileNames[i]);
+    }
 
-// Draw a texture with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
-{
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
+    RL_FREE(batch.fileNames);
+    RL_FREE(batch.textures);
 }
 
-// Draw a texture with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+// Load pending textures of the batch within a time budget (in seconds), returns true when batch is completed
+// NOTE: Time budget is checked before every texture upload, at least one texture is loaded per call if available,
+// with SUPPORT_IMAGE_THREADS files are decoded on worker threads and only uploaded here (any order)
+bool UpdateTextureBatch(TextureBatch *batch, float timeBudget)
 {
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    rTextureBatchData *data = batch->data;
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
-}
-
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
-{
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+    if (data == NULL) return (batch->processed == batch->count);
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
-}
+    double startTime = GetTime();
+    int uploadCount = 0;
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
-{
-    // Check if texture is valid
-    if (texture.id > 0)
+    while (batch->processed < batch->count)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        if ((uploadCount > 0) && ((GetTime() - startTime) >= timeBudget)) break;
 
-        bool flipX = false;
+        int index = -1;
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+#if defined(SUPPORT_IMAGE_THREADS)
+        if (data->threadCount > 0)
+        {
+            // Get next file already decoded, do not wait for decoding threads
+            pthread_mutex_lock(&data->mutex);
 
-        if (dest.width < 0) dest.width *= -1;
-        if (dest.height < 0) dest.height *= -1;
+            while ((data->firstPending < data->count) && (data->states[data->firstPending] == TEXTURE_BATCH_FILE_PROCESSED)) data->firstPending++;
 
-        Vector2 topLeft = { 0 };
-        Vector2 topRight = { 0 };
-        Vector2 bottomLeft = { 0 };
-        Vector2 bottomRight = { 0 };
+            for (int i = data->firstPending; i < data->count; i++)
+            {
+                if (data->states[i] == TEXTURE_BATCH_FILE_DECODED) { index = i; break; }
+            }
 
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
-        {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (Vector2){ x, y };
-            topRight = (Vector2){ x + dest.width, y };
-            bottomLeft = (Vector2){ x, y + dest.height };
-            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+            batch->decoded = data->decoded;
+            pthread_mutex_unlock(&data->mutex);
+
+            if (index == -1) break;
         }
         else
+#endif
         {
-            float sinRotation = sinf(rotation*DEG2RAD);
-            float cosRotation = cosf(rotation*DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
+            // Decode next file on calling thread
+            index = data->nextFile;
+            data->images[index] = LoadImage(data->fileNames[index]);
+            data->states[index] = TEXTURE_BATCH_FILE_DECODED;
+            data->nextFile++;
+            data->decoded++;
+            batch->decoded = data->decoded;
+        }
 
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+        if (data->images[index].data != NULL) batch->textures[index] = LoadTextureFromImage(data->images[index]);
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+        UnloadImage(data->images[index]);
+        data->images[index] = (Image){ 0 };
+        uploadCount++;
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+#if defined(SUPPORT_IMAGE_THREADS)
+        if (data->threadCount > 0) pthread_mutex_lock(&data->mutex);
+#endif
+        data->states[index] = TEXTURE_BATCH_FILE_PROCESSED;
+#if defined(SUPPORT_IMAGE_THREADS)
+        if (data->threadCount > 0) pthread_mutex_unlock(&data->mutex);
+#endif
+        batch->processed++;
+    }
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
-        }
+    return (batch->processed == batch->count);
+}
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+// Get textures batch loading progress [0.0f..1.0f], files decoding and textures upload
+float GetTextureBatchProgress(TextureBatch batch)
+{
+    return (batch.count > 0)? (float)(batch.decoded + batch.processed)/(float)(2*batch.count) : 1.0f;
+}
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load dynamic texture atlas (VRAM), images are packed into the atlas texture on demand
+// NOTE: A pixel data copy is kept in RAM to allow regions repacking
+TextureAtlas LoadTextureAtlas(int width, int height, int format)
+{
+    TextureAtlas atlas = { 0 };
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+    if ((width <= 0) || (height <= 0) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas parameters not valid, compressed formats not supported");
+        return atlas;
+    }
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+    rAtlasData *data = (rAtlasData *)RL_CALLOC(1, sizeof(rAtlasData));
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+    data->image.data = RL_CALLOC(GetPixelDataSize(width, height, format), 1);
+    data->image.width = width;
+    data->image.height = height;
+    data->image.mipmaps = 1;
+    data->image.format = format;
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    data->packer = LoadSkylinePacker(width, height);
 
-        rlEnd();
-        rlSetTexture(0);
+    atlas.texture = LoadTextureFromImage(data->image);
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than just calculating
-        // the vertex positions manually, like done above
-        // I leave here the old implementation for educational purposes,
-        // just in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    if (atlas.texture.id == 0)
+    {
+        UnloadSkylinePacker(data->packer);
+        RL_FREE(data->image.data);
+        RL_FREE(data);
+        return atlas;
+    }
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    atlas.data = data;
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Atlas loaded successfully (%ix%i)", atlas.texture.id, width, height);
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+    return atlas;
+}
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+// Check if a texture atlas is valid (loaded in GPU)
+bool IsTextureAtlasValid(TextureAtlas atlas)
+{
+    return ((atlas.data != NULL) && IsTextureValid(atlas.texture));
+}
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+// Unload texture atlas from GPU memory (VRAM) and internal data from RAM
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    if (atlas.data != NULL)
+    {
+        UnloadSkylinePacker(atlas.data->packer);
+        RL_FREE(atlas.data->image.data);
+        RL_FREE(atlas.data->freeRecs);
+        RL_FREE(atlas.data->recs);
+        RL_FREE(atlas.data->lastUse);
+        RL_FREE(atlas.data);
     }
+
+    UnloadTexture(atlas.texture);
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Add image to texture atlas, returns region id or -1 if image does not fit
+// NOTE 1: Image is converted to atlas format if required, the provided image is not modified
+// NOTE 2: If there is no space left, least recently used regions are evicted and their space reused,
+// atlas is only repacked when enough space is available but fragmented
+int AddTextureAtlasImage(TextureAtlas atlas, Image image)
 {
-    if (texture.id > 0)
-    {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+    int id = -1;
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+    if ((atlas.data == NULL) || (image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return id;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+    rAtlasData *data = atlas.data;
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+    if (((image.width + TEXTURE_ATLAS_PADDING) > data->image.width) ||
+        ((image.height + TEXTURE_ATLAS_PADDING) > data->image.height))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image does not fit into atlas (%ix%i)", atlas.texture.id, image.width, image.height);
+        return id;
+    }
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
-        {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
-        }
+    // Get a free region id, ids of removed regions are reused
+    // NOTE: Evicted regions keep their id until removed, so they can be detected by user
+    for (int i = 0; i < data->regionCount; i++)
+    {
+        if (data->lastUse[i] == 0) { id = i; break; }
+    }
 
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+    if (id == -1)
+    {
+        if (data->regionCount == data->regionCapacity)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            data->regionCapacity = (data->regionCapacity == 0)? 64 : data->regionCapacity*2;
+            data->recs = (Rectangle *)RL_REALLOC(data->recs, data->regionCapacity*sizeof(Rectangle));
+            data->lastUse = (unsigned int *)RL_REALLOC(data->lastUse, data->regionCapacity*sizeof(unsigned int));
         }
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+        id = data->regionCount;
+        data->recs[id] = (Rectangle){ 0 };
+        data->lastUse[id] = 0;
+        data->regionCount++;
+    }
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+    int x = 0;
+    int y = 0;
+    int packWidth = image.width + TEXTURE_ATLAS_PADDING;
+    int packHeight = image.height + TEXTURE_ATLAS_PADDING;
+    bool packed = PackTextureAtlasRec(data, packWidth, packHeight, &x, &y);
+    bool repacked = false;
+
+    // No space left: evict least recently used regions one by one, released space is reused directly,
+    // live regions are repacked (once) only when enough space is available but fragmented
+    while (!packed)
+    {
+        if (!repacked && ((data->image.width*data->image.height - data->usedArea) >= packWidth*packHeight))
+        {
+            PackTextureAtlas(atlas);
+            repacked = true;
+        }
+        else if (!EvictTextureAtlasRegion(atlas)) break;
 
-        rlSetTexture(texture.id);
+        packed = PackTextureAtlasRec(data, packWidth, packHeight, &x, &y);
+    }
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    if (!packed)
+    {
+        if (id == (data->regionCount - 1)) data->regionCount--;
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to pack image into atlas", atlas.texture.id);
+        return -1;
+    }
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+    data->recs[id] = (Rectangle){ (float)x, (float)y, (float)image.width, (float)image.height };
+    data->usedArea += packWidth*packHeight;
+    data->useCounter++;
+    data->lastUse[id] = data->useCounter;
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
+    // Copy image into atlas pixel data, converted to atlas format if required
+    Image region = image;
+    if (image.format != data->image.format)
+    {
+        region = ImageCopy(image);
+        ImageFormat(&region, data->image.format);
+    }
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+    int bytesPerPixel = GetPixelDataSize(1, 1, data->image.format);
+    for (int row = 0; row < region.height; row++)
+    {
+        memcpy((unsigned char *)data->image.data + ((size_t)(y + row)*data->image.width + x)*bytesPerPixel,
+            (unsigned char *)region.data + (size_t)row*region.width*bytesPerPixel, region.width*bytesPerPixel);
+    }
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+    if (region.data != image.data) UnloadImage(region);
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
-                {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
-                {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                }
-            rlEnd();
-        rlPopMatrix();
+    // Upload only the region to GPU
+    UploadTextureAtlasRec(atlas, data->recs[id]);
 
-        rlSetTexture(0);
-    }
+    return id;
 }
 
-// Check if two colors are equal
-bool ColorIsEqual(Color col1, Color col2)
+// Remove image region from texture atlas, region id can be reused
+// NOTE: Region space is reused by next images added
+void RemoveTextureAtlasImage(TextureAtlas atlas, int id)
 {
-    bool result = false;
-
-    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+    if ((atlas.data == NULL) || (id < 0) || (id >= atlas.data->regionCount)) return;
 
-    return result;
+    if (atlas.data->recs[id].width > 0) ReleaseTextureAtlasRec(atlas.data, id);
+    atlas.data->lastUse[id] = 0;
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+// Get region rectangle in atlas texture, useful for DrawTextureRec()
+// NOTE: Region is marked as used, evicted regions return an empty rectangle
+Rectangle GetTextureAtlasRec(TextureAtlas atlas, int id)
 {
-    Color result = color;
+    Rectangle rec = { 0 };
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    if ((atlas.data == NULL) || (id < 0) || (id >= atlas.data->regionCount)) return rec;
 
-    result.a = (unsigned char)(255.0f*alpha);
+    rec = atlas.data->recs[id];
 
-    return result;
+    if ((rec.width > 0) && (rec.height > 0))
+    {
+        atlas.data->useCounter++;
+        atlas.data->lastUse[id] = atlas.data->useCounter;
+    }
+
+    return rec;
 }
 
-// Get hexadecimal value for a Color
-int ColorToInt(Color color)
+// Repack texture atlas regions to recover space from removed and evicted regions
+// NOTE 1: Regions are moved, rectangles must be retrieved again with GetTextureAtlasRec()
+// NOTE 2: Only moved regions are uploaded to GPU
+void PackTextureAtlas(TextureAtlas atlas)
 {
-    int result = 0;
+    if (atlas.data == NULL) return;
 
-    result = (int)(((unsigned int)color.r << 24) |
-                   ((unsigned int)color.g << 16) |
-                   ((unsigned int)color.b << 8) |
+    rAtlasData *data = atlas.data;
+
+    // Sort live regions by height (descending), it gives denser skyline packing
+    int *order = (int *)RL_MALLOC(data->regionCount*sizeof(int));
+    int liveCount = 0;
+
+    for (int i = 0; i < data->regionCount; i++)
+    {
+        if (data->recs[i].width > 0)
+        {
+            int k = liveCount;
+            while ((k > 0) && (data->recs[order[k - 1]].height < data->recs[i].height)) { order[k] = order[k - 1]; k--; }
+            order[k] = i;
+            liveCount++;
+        }
+    }
+
+    Image image = { 0 };
+    image.data = RL_CALLOC(GetPixelDataSize(data->image.width, data->image.height, data->image.format), 1);
+    image.width = data->image.width;
+    image.height = data->image.height;
+    image.mipmaps = 1;
+    image.format = data->image.format;
+
+    ResetSkylinePacker(data->packer);
+    data->freeCount = 0;
+    data->usedArea = 0;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    bool *moved = (bool *)RL_CALLOC(liveCount, sizeof(bool));
+
+    for (int i = 0; i < liveCount; i++)
+    {
+        Rectangle *rec = &data->recs[order[i]];
+        int x = 0;
+        int y = 0;
+
+        // NOTE: Regions that do not fit anymore (packing order changed) are evicted
+        if (PackSkylineRec(data->packer, (int)rec->width + TEXTURE_ATLAS_PADDING, (int)rec->height + TEXTURE_ATLAS_PADDING, &x, &y))
+        {
+            for (int row = 0; row < (int)rec->height; row++)
+            {
+                memcpy((unsigned char *)image.data + ((size_t)(y + row)*image.width + x)*bytesPerPixel,
+                    (unsigned char *)data->image.data + ((size_t)((int)rec->y + row)*image.width + (int)rec->x)*bytesPerPixel,
+                    (int)rec->width*bytesPerPixel);
+            }
+
+            moved[i] = ((x != (int)rec->x) || (y != (int)rec->y));
+            rec->x = (float)x;
+            rec->y = (float)y;
+            data->usedArea += ((int)rec->width + TEXTURE_ATLAS_PADDING)*((int)rec->height + TEXTURE_ATLAS_PADDING);
+        }
+        else *rec = (Rectangle){ 0 };
+    }
+
+    RL_FREE(data->image.data);
+    data->image = image;
+
+    // Upload moved regions only, space left by regions is not referenced anymore
+    for (int i = 0; i < liveCount; i++)
+    {
+        if (moved[i]) UploadTextureAtlasRec(atlas, data->recs[order[i]]);
+    }
+
+    RL_FREE(moved);
+    RL_FREE(order);
+}
+
+//------------------------------------------------------------------------------------
+// Virtual texture functions
+//------------------------------------------------------------------------------------
+// Virtual texture pages are stored with a border into a physical cache texture (slots grid),
+// the indirection texture has one texel per base level page, pointing to the finest resident page covering it:
+//   indirection texel: r = cache slot x, g = cache slot y, b = page mip level, a = 255
+// A page at mip level L covers (pageSize << L) virtual texels, sampling shader is expected to compute:
+//   entry = texelFetch(indirection, ivec2(uv*virtualSize/pageSize), 0)*255
+//   local = fract(uv*virtualSize/float(pageSize << entry.b))*pageSize
+//   cacheUV = (entry.rg*(pageSize + 2*border) + border + local)/cacheSize
+// Feedback pass is expected to write requested pages as R8G8B8A8 pixels:
+//   r = page x (low 8 bits), g = page y (low 8 bits), b = page x (high 4 bits) | page y (high 4 bits) << 4, a = mip level + 1 (0 for no request)
+
+// Load virtual texture from image, pages are streamed into a cache texture (VRAM) within budget (bytes)
+// NOTE: Image mip levels are generated and kept in RAM as pages source, coarsest level is always resident
+VirtualTexture LoadVirtualTexture(Image image, int pageSize, int budget)
+{
+    VirtualTexture texture = { 0 };
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (pageSize <= 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Virtual texture parameters not valid, compressed formats not supported");
+        return texture;
+    }
+
+    int physicalPageSize = pageSize + 2*VIRTUAL_TEXTURE_PAGE_BORDER;
+    int slotCount = budget/(physicalPageSize*physicalPageSize*4);
+    int slotsX = MIN((int)sqrtf((float)slotCount), 256);
+    int slotsY = (slotsX > 0)? MIN(slotCount/slotsX, 256) : 0;
+
+    rVirtualTextureData *data = (rVirtualTextureData *)RL_CALLOC(1, sizeof(rVirtualTextureData));
+
+    // Generate source mip levels, until a level fits in a single page
+    data->levelCount = 1;
+    while (((MAX(image.width >> (data->levelCount - 1), 1) > pageSize) || (MAX(image.height >> (data->levelCount - 1), 1) > pageSize))) data->levelCount++;
+
+    data->levels = (Image *)RL_CALLOC(data->levelCount, sizeof(Image));
+    data->levelPagesX = (int *)RL_CALLOC(data->levelCount, sizeof(int));
+    data->levelPagesY = (int *)RL_CALLOC(data->levelCount, sizeof(int));
+    data->levelOffset = (int *)RL_CALLOC(data->levelCount, sizeof(int));
+
+    data->levels[0] = ImageCopy(image);
+    ImageFormat(&data->levels[0], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    for (int level = 0; level < data->levelCount; level++)
+    {
+        if (level > 0)
+        {
+            data->levels[level] = ImageCopy(data->levels[level - 1]);
+            ImageResize(&data->levels[level], MAX(data->levels[level - 1].width/2, 1), MAX(data->levels[level - 1].height/2, 1));
+        }
+
+        data->levelPagesX[level] = (data->levels[level].width + pageSize - 1)/pageSize;
+        data->levelPagesY[level] = (data->levels[level].height + pageSize - 1)/pageSize;
+        data->levelOffset[level] = data->pageCount;
+        data->pageCount += data->levelPagesX[level]*data->levelPagesY[level];
+    }
+
+    int topLevel = data->levelCount - 1;
+    int topPageCount = data->levelPagesX[topLevel]*data->levelPagesY[topLevel];
+
+    if ((slotsX*slotsY) <= topPageCount)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Virtual texture budget too small, required more than %i pages", topPageCount);
+        UnloadVirtualTexture((VirtualTexture){ .data = data });
+        return texture;
+    }
+
+    data->pageSize = pageSize;
+    data->slotsX = slotsX;
+    data->slotsY = slotsY;
+    data->pageSlot = (int *)RL_MALLOC(data->pageCount*sizeof(int));
+    data->pageRequest = (unsigned int *)RL_CALLOC(data->pageCount, sizeof(unsigned int));
+    data->slotPage = (int *)RL_MALLOC(slotsX*slotsY*sizeof(int));
+    data->slotLastUse = (unsigned int *)RL_CALLOC(slotsX*slotsY, sizeof(unsigned int));
+    data->requests = (int *)RL_MALLOC(data->pageCount*sizeof(int));
+    data->indirection = (unsigned char *)RL_CALLOC(data->levelPagesX[0]*data->levelPagesY[0], 4);
+    data->pageBuffer = (unsigned char *)RL_MALLOC(physicalPageSize*physicalPageSize*4);
+
+    for (int i = 0; i < data->pageCount; i++) data->pageSlot[i] = -1;
+    for (int i = 0; i < slotsX*slotsY; i++) data->slotPage[i] = -1;
+
+    texture.cache.id = rlLoadTexture(NULL, slotsX*physicalPageSize, slotsY*physicalPageSize, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    texture.cache.width = slotsX*physicalPageSize;
+    texture.cache.height = slotsY*physicalPageSize;
+    texture.cache.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    texture.cache.mipmaps = 1;
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.pageSize = pageSize;
+    texture.data = data;
+
+    if (texture.cache.id == 0)
+    {
+        UnloadVirtualTexture(texture);
+        return (VirtualTexture){ 0 };
+    }
+
+    SetTextureFilter(texture.cache, TEXTURE_FILTER_BILINEAR);
+
+    // Coarsest level pages are always resident, used as fallback for any other page
+    for (int i = 0; i < topPageCount; i++)
+    {
+        LoadVirtualTexturePage(texture, data->levelOffset[topLevel] + i, i);
+        data->slotLastUse[i] = UINT_MAX;
+    }
+
+    UpdateVirtualTextureIndirection(texture);
+
+    Image indirection = { data->indirection, data->levelPagesX[0], data->levelPagesY[0], 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    texture.indirection = LoadTextureFromImage(indirection);
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Virtual texture loaded successfully (%ix%i | %i levels | %i cache pages)", texture.cache.id, image.width, image.height, data->levelCount, slotsX*slotsY);
+
+    return texture;
+}
+
+// Check if a virtual texture is valid (loaded in GPU)
+bool IsVirtualTextureValid(VirtualTexture texture)
+{
+    return ((texture.data != NULL) && IsTextureValid(texture.cache) && IsTextureValid(texture.indirection));
+}
+
+// Unload virtual texture from GPU memory (VRAM) and pages source from RAM
+void UnloadVirtualTexture(VirtualTexture texture)
+{
+    rVirtualTextureData *data = texture.data;
+
+    if (data != NULL)
+    {
+        for (int i = 0; i < data->levelCount; i++) UnloadImage(data->levels[i]);
+
+        RL_FREE(data->levels);
+        RL_FREE(data->levelPagesX);
+        RL_FREE(data->levelPagesY);
+        RL_FREE(data->levelOffset);
+        RL_FREE(data->pageSlot);
+        RL_FREE(data->pageRequest);
+        RL_FREE(data->slotPage);
+        RL_FREE(data->slotLastUse);
+        RL_FREE(data->requests);
+        RL_FREE(data->indirection);
+        RL_FREE(data->pageBuffer);
+        RL_FREE(data);
+    }
+
+    if (texture.cache.id > 0) UnloadTexture(texture.cache);
+    if (texture.indirection.id > 0) UnloadTexture(texture.indirection);
+}
+
+// Update virtual texture pages residency from feedback pass image
+// NOTE: Up to VIRTUAL_TEXTURE_MAX_PAGE_UPLOADS pages are uploaded per call, coarser levels first,
+// least recently requested pages are evicted when cache is full
+void UpdateVirtualTexture(VirtualTexture texture, Image feedback)
+{
+    rVirtualTextureData *data = texture.data;
+
+    if ((data == NULL) || (feedback.data == NULL)) return;
+
+    if (feedback.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Virtual texture feedback must be R8G8B8A8 format");
+        return;
+    }
+
+    data->frameCounter++;
+
+    // Collect unique requested pages, parent pages are also requested to keep fallbacks resident
+    int requestCount = 0;
+    const unsigned char *pixels = (const unsigned char *)feedback.data;
+
+    for (int i = 0; i < feedback.width*feedback.height; i++)
+    {
+        const unsigned char *pixel = pixels + i*4;
+
+        if (pixel[3] == 0) continue;
+
+        int level = MIN(pixel[3] - 1, data->levelCount - 1);
+        int pageX = pixel[0] | ((pixel[2] & 0x0f) << 8);
+        int pageY = pixel[1] | ((pixel[2] >> 4) << 8);
+
+        if ((pageX >= data->levelPagesX[level]) || (pageY >= data->levelPagesY[level])) continue;
+
+        for (; level < data->levelCount; level++, pageX /= 2, pageY /= 2)
+        {
+            int page = data->levelOffset[level] + pageY*data->levelPagesX[level] + pageX;
+
+            if (data->pageRequest[page] == data->frameCounter) break;
+            data->pageRequest[page] = data->frameCounter;
+
+            if (data->pageSlot[page] >= 0)
+            {
+                int slot = data->pageSlot[page];
+                if (data->slotLastUse[slot] != UINT_MAX) data->slotLastUse[slot] = data->frameCounter;
+            }
+            else data->requests[requestCount++] = page;
+        }
+    }
+
+    // Pages with greater index belong to coarser levels, load them first
+    qsort(data->requests, requestCount, sizeof(int), CompareVirtualTexturePages);
+
+    int uploadCount = 0;
+    int slotCount = data->slotsX*data->slotsY;
+
+    for (int i = 0; (i < requestCount) && (uploadCount < VIRTUAL_TEXTURE_MAX_PAGE_UPLOADS); i++)
+    {
+        // Find free slot or least recently used one, pages requested this frame are never evicted
+        int slot = -1;
+        unsigned int oldestUse = data->frameCounter;
+
+        for (int s = 0; s < slotCount; s++)
+        {
+            if (data->slotPage[s] < 0) { slot = s; break; }
+            if (data->slotLastUse[s] < oldestUse) { oldestUse = data->slotLastUse[s]; slot = s; }
+        }
+
+        if (slot < 0) break;
+
+        if (data->slotPage[slot] >= 0) data->pageSlot[data->slotPage[slot]] = -1;
+
+        LoadVirtualTexturePage(texture, data->requests[i], slot);
+        data->slotLastUse[slot] = data->frameCounter;
+        uploadCount++;
+    }
+
+    if (uploadCount > 0)
+    {
+        UpdateVirtualTextureIndirection(texture);
+        UpdateTexture(texture.indirection, data->indirection);
+    }
+}
+
+// Get virtual texture number of pages resident in cache
+int GetVirtualTextureResidentPages(VirtualTexture texture)
+{
+    int count = 0;
+
+    if (texture.data != NULL)
+    {
+        for (int i = 0; i < texture.data->slotsX*texture.data->slotsY; i++) if (texture.data->slotPage[i] >= 0) count++;
+    }
+
+    return count;
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrap)
+{
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        if (dest.width < 0) dest.width *= -1;
+        if (dest.height < 0) dest.height *= -1;
+
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + dest.width, y };
+            bottomLeft = (Vector2){ x, y + dest.height };
+            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            // Top-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            else rlTexCoord2f(source.x/width, source.y/height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            // Bottom-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Bottom-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            rlVertex2f(topRight.x, topRight.y);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than just calculating
+        // the vertex positions manually, like done above
+        // I leave here the old implementation for educational purposes,
+        // just in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlSetTexture(0);
+    }
+}
+
+// Check if two colors are equal
+bool ColorIsEqual(Color col1, Color col2)
+{
+    bool result = false;
+
+    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    int result = 0;
+
+    result = (int)(((unsigned int)color.r << 24) |
+                   ((unsigned int)color.g << 16) |
+                   ((unsigned int)color.b << 8) |
                     (unsigned int)color.a);
 
-    return result;
+    return result;
+}
+
+// Get color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
+{
+    Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Get a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Get color multiplied with another color
+Color ColorTint(Color color, Color tint)
+{
+    Color result = color;
+
+    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+    result.r = r;
+    result.g = g;
+    result.b = b;
+    result.a = a;
+
+    return result;
+}
+
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+Color ColorBrightness(Color color, float factor)
+{
+    Color result = color;
+
+    if (factor > 1.0f) factor = 1.0f;
+    else if (factor < -1.0f) factor = -1.0f;
+
+    float red = (float)color.r;
+    float green = (float)color.g;
+    float blue = (float)color.b;
+
+    if (factor < 0.0f)
+    {
+        factor = 1.0f + factor;
+        red *= factor;
+        green *= factor;
+        blue *= factor;
+    }
+    else
+    {
+        red = (255 - red)*factor + red;
+        green = (255 - green)*factor + green;
+        blue = (255 - blue)*factor + blue;
+    }
+
+    result.r = (unsigned char)red;
+    result.g = (unsigned char)green;
+    result.b = (unsigned char)blue;
+
+    return result;
+}
+
+// Get color with contrast correction
+// NOTE: Contrast values between -1.0f and 1.0f
+Color ColorContrast(Color color, float contrast)
+{
+    Color result = color;
+
+    if (contrast < -1.0f) contrast = -1.0f;
+    else if (contrast > 1.0f) contrast = 1.0f;
+
+    contrast = (1.0f + contrast);
+    contrast *= contrast;
+
+    float pR = (float)color.r/255.0f;
+    pR -= 0.5f;
+    pR *= contrast;
+    pR += 0.5f;
+    pR *= 255;
+    if (pR < 0) pR = 0;
+    else if (pR > 255) pR = 255;
+
+    float pG = (float)color.g/255.0f;
+    pG -= 0.5f;
+    pG *= contrast;
+    pG += 0.5f;
+    pG *= 255;
+    if (pG < 0) pG = 0;
+    else if (pG > 255) pG = 255;
+
+    float pB = (float)color.b/255.0f;
+    pB -= 0.5f;
+    pB *= contrast;
+    pB += 0.5f;
+    pB *= 255;
+    if (pB < 0) pB = 0;
+    else if (pB > 255) pB = 255;
+
+    result.r = (unsigned char)pR;
+    result.g = (unsigned char)pG;
+    result.b = (unsigned char)pB;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
+{
+    Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+Color ColorLerp(Color color1, Color color2, float factor)
+{
+    Color color = { 0 };
+
+    if (factor < 0.0f) factor = 0.0f;
+    else if (factor > 1.0f) factor = 1.0f;
+
+    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
+    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
+    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
+    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+
+    return color;
+}
+
+// Get a Color struct from hexadecimal value
+Color GetColor(unsigned int hexValue)
+{
+    Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
+    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
+    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
+    color.a = (unsigned char)hexValue & 0xFF;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
+{
+    Color color = { 0 };
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+
+        } break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
+
+        } break;
+        default: break;
+    }
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    double bytesPerPixel = (double)bpp/8.0;
+    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks,
+    // if texture is smaller, minimum dataSize is 8 or 16
+    if ((width < 4) && (height < 4))
+    {
+        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
+        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+    }
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int *)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int *) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Get color converted to the provided pixel format data
+// NOTE: Returns the pixel size in bytes, 0 if format is not supported (compressed formats)
+static int GetPixelDataFromColor(Color color, int format, unsigned char *pixel)
+{
+    int bytesPerPixel = 0;
+
+    if ((format > 0) && (format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        Image image = { pixel, 1, 1, 1, format };
+        ImageDrawPixel(&image, 0, 0, color);
+        bytesPerPixel = GetPixelDataSize(1, 1, format);
+    }
+
+    return bytesPerPixel;
+}
+
+// Fill an horizontal span of pixels [startX..endX] on row y with provided pixel data
+// NOTE: Span is clipped to image bounds, pixel data must match image format
+static void ImageFillSpan(Image *dst, int startX, int endX, int y, const unsigned char *pixel, int bytesPerPixel)
+{
+    if ((y < 0) || (y >= dst->height)) return;
+    if (startX < 0) startX = 0;
+    if (endX >= dst->width) endX = dst->width - 1;
+    if (endX < startX) return;
+
+    unsigned char *pRow = (unsigned char *)dst->data + ((size_t)y*dst->width + startX)*bytesPerPixel;
+    int spanSize = (endX - startX + 1)*bytesPerPixel;
+
+    // Copy first pixel and keep doubling the already filled region
+    memcpy(pRow, pixel, bytesPerPixel);
+
+    for (int filled = bytesPerPixel; filled < spanSize; filled *= 2)
+    {
+        memcpy(pRow + filled, pRow, ((spanSize - filled) < filled)? (spanSize - filled) : filled);
+    }
+}
+
+// Draw line within an image using already converted pixel data
+static void ImageDrawLinePixel(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, const unsigned char *pixel, int bytesPerPixel)
+{
+    // Calculate differences in coordinates
+    int shortLen = endPosY - startPosY;
+    int longLen = endPosX - startPosX;
+    bool yLonger = false;
+
+    // Determine if the line is more vertical than horizontal
+    if (abs(shortLen) > abs(longLen))
+    {
+        // Swap the lengths if the line is more vertical
+        int temp = shortLen;
+        shortLen = longLen;
+        longLen = temp;
+        yLonger = true;
+    }
+
+    // Initialize variables for drawing loop
+    int endVal = longLen;
+    int sgnInc = 1;
+
+    // Adjust direction increment based on longLen sign
+    if (longLen < 0)
+    {
+        longLen = -longLen;
+        sgnInc = -1;
+    }
+
+    // Calculate fixed-point increment for shorter length
+    int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
+
+    // Draw the line pixel by pixel
+    if (yLonger)
+    {
+        // If line is more vertical, iterate over y-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        {
+            // Calculate pixel position and draw it
+            int x = startPosX + (j >> 16);
+            int y = startPosY + i;
+
+            if ((x >= 0) && (x < dst->width) && (y >= 0) && (y < dst->height))
+            {
+                memcpy((unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel, pixel, bytesPerPixel);
+            }
+        }
+    }
+    else
+    {
+        // If line is more horizontal, iterate over x-axis
+        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        {
+            // Calculate pixel position and draw it
+            int x = startPosX + i;
+            int y = startPosY + (j >> 16);
+
+            if ((x >= 0) && (x < dst->width) && (y >= 0) && (y < dst->height))
+            {
+                memcpy((unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel, pixel, bytesPerPixel);
+            }
+        }
+    }
+}
+
+// Copy first row into rows range, row index 0 is the row following the first one
+static void FillImageRows(void *data, int start, int end)
+{
+    ImageRowsFill *fill = (ImageRowsFill *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        memcpy(fill->firstRow + (size_t)(i + 1)*fill->rowStride, fill->firstRow, fill->bytesPerRow);
+    }
+}
+
+// Fill triangle spans on rows range, row index 0 is the bounding box top row
+// NOTE: The triangle is convex, so pixels inside it on every row form a single span,
+// span limits are solved from the edge functions: w(x) = wRow + wXStep*(x - xMin) >= 0
+static void FillImageTriangleRows(void *data, int start, int end)
+{
+    ImageTriangleFill *fill = (ImageTriangleFill *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        int spanStart = fill->xMin;
+        int spanEnd = fill->xMax;
+
+        for (int e = 0; (e < 3) && (spanStart <= spanEnd); e++)
+        {
+            int w = fill->wRows[e] + i*fill->wYSteps[e];
+            int step = fill->wXSteps[e];
+
+            if (step == 0) { if (w < 0) spanEnd = spanStart - 1; }
+            else if (step > 0)
+            {
+                // First x where the edge function becomes positive: ceil(-w/step)
+                if (w < 0)
+                {
+                    int x = fill->xMin + (-w + step - 1)/step;
+                    if (x > spanStart) spanStart = x;
+                }
+            }
+            else
+            {
+                // Last x where the edge function is still positive: floor(w/-step)
+                if (w < 0) spanEnd = spanStart - 1;
+                else
+                {
+                    int x = fill->xMin + w/(-step);
+                    if (x < spanEnd) spanEnd = x;
+                }
+            }
+        }
+
+        if (spanStart <= spanEnd) ImageFillSpan(fill->dst, spanStart, spanEnd, fill->yMin + i, fill->pixel, fill->bytesPerPixel);
+    }
+}
+
+// Process items range [0, count), split in contiguous ranges between threads
+// NOTE: itemWork is the approximated work per item (i.e. pixels per row), small jobs are processed by calling thread,
+// every item must be written by a single range, batch 0 is processed by calling thread, batches failing to start too
+static void ProcessImageItems(ImageProcessCallback process, void *data, int count, int itemWork)
+{
+    if (count <= 0) return;
+
+#if defined(SUPPORT_IMAGE_THREADS)
+    long long threadCount = (long long)count*((itemWork > 0)? itemWork : 1)/IMAGE_PROCESS_THREAD_MIN_WORK;
+    if (threadCount > IMAGE_PROCESS_MAX_THREADS) threadCount = IMAGE_PROCESS_MAX_THREADS;
+    if (threadCount > count) threadCount = count;
+
+    if (threadCount > 1)
+    {
+        ImageProcessBatch batches[IMAGE_PROCESS_MAX_THREADS] = { 0 };
+        pthread_t threads[IMAGE_PROCESS_MAX_THREADS] = { 0 };
+        bool threadRunning[IMAGE_PROCESS_MAX_THREADS] = { 0 };
+
+        for (int t = 0; t < threadCount; t++)
+        {
+            batches[t].process = process;
+            batches[t].data = data;
+            batches[t].start = (int)((long long)count*t/threadCount);
+            batches[t].end = (int)((long long)count*(t + 1)/threadCount);
+
+            if (t > 0) threadRunning[t] = (pthread_create(&threads[t], NULL, ProcessImageBatch, &batches[t]) == 0);
+        }
+
+        for (int t = 0; t < threadCount; t++)
+        {
+            if (!threadRunning[t]) ProcessImageBatch(&batches[t]);
+        }
+
+        for (int t = 1; t < threadCount; t++)
+        {
+            if (threadRunning[t]) pthread_join(threads[t], NULL);
+        }
+    }
+    else process(data, 0, count);
+#else
+    process(data, 0, count);
+#endif
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOI) || defined(SUPPORT_FILEFORMAT_PNG)
+// Init image region filter, region is clamped to image bounds (zero size region uses full image)
+// NOTE: Last cell of every row/column also absorbs the remaining pixels when region size is not a multiple of scale
+static bool InitImageRegionFilter(ImageRegionFilter *filter, int width, int height, int channels, Rectangle region, int scale)
+{
+    filter->x = 0;
+    filter->y = 0;
+    filter->width = width;
+    filter->height = height;
+
+    if ((region.width > 0) && (region.height > 0))
+    {
+        filter->x = (int)region.x;
+        filter->y = (int)region.y;
+        filter->width = (int)region.width;
+        filter->height = (int)region.height;
+
+        if (filter->x < 0) { filter->width += filter->x; filter->x = 0; }
+        if (filter->y < 0) { filter->height += filter->y; filter->y = 0; }
+        if ((filter->x + filter->width) > width) filter->width = width - filter->x;
+        if ((filter->y + filter->height) > height) filter->height = height - filter->y;
+    }
+
+    if ((filter->width <= 0) || (filter->height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Region out of image bounds");
+        return false;
+    }
+
+    filter->scale = scale;
+    filter->channels = channels;
+    filter->outWidth = MAX(1, filter->width/scale);
+    filter->outHeight = MAX(1, filter->height/scale);
+    filter->rowCount = 0;
+    filter->rowsInCell = 0;
+    filter->outY = 0;
+
+    filter->row = (unsigned char *)RL_MALLOC((size_t)filter->width*channels);
+    filter->rowSums = (unsigned int *)RL_CALLOC(filter->outWidth*channels, sizeof(unsigned int));
+    filter->pixels = (unsigned char *)RL_MALLOC((size_t)filter->outWidth*filter->outHeight*channels);
+
+    return true;
+}
+
+// Add region row pixels to image region filter, a row of cells is written once complete
+static void AddImageRegionRow(ImageRegionFilter *filter)
+{
+    int channels = filter->channels;
+
+    for (int x = 0; x < filter->width; x++)
+    {
+        unsigned int *sum = filter->rowSums + MIN(x/filter->scale, filter->outWidth - 1)*channels;
+        const unsigned char *src = filter->row + x*channels;
+
+        for (int c = 0; c < channels; c++) sum[c] += src[c];
+    }
+
+    filter->rowCount++;
+    filter->rowsInCell++;
+
+    if (((filter->outY < (filter->outHeight - 1)) && (filter->rowsInCell == filter->scale)) || (filter->rowCount == filter->height))
+    {
+        for (int cell = 0; cell < filter->outWidth; cell++)
+        {
+            int columnsInCell = (cell < (filter->outWidth - 1))? filter->scale : (filter->width - cell*filter->scale);
+            unsigned int count = columnsInCell*filter->rowsInCell;
+            unsigned char *dst = filter->pixels + ((size_t)filter->outY*filter->outWidth + cell)*channels;
+
+            for (int c = 0; c < channels; c++) dst[c] = (unsigned char)((filter->rowSums[cell*channels + c] + count/2)/count);
+        }
+
+        memset(filter->rowSums, 0, filter->outWidth*channels*sizeof(unsigned int));
+        filter->rowsInCell = 0;
+        filter->outY++;
+    }
+}
+
+// Unload image region filter working buffers, returns resulting image if all region rows were added
+static Image UnloadImageRegionFilter(ImageRegionFilter *filter)
+{
+    Image image = { 0 };
+
+    RL_FREE(filter->row);
+    RL_FREE(filter->rowSums);
+
+    if (filter->rowCount == filter->height)
+    {
+        image.data = filter->pixels;
+        image.width = filter->outWidth;
+        image.height = filter->outHeight;
+        image.mipmaps = 1;
+
+        if (filter->channels == 1) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        else if (filter->channels == 2) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        else if (filter->channels == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+        else image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+    else RL_FREE(filter->pixels);
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_QOI)
+// Load image region from QOI data, decoding pixels as a stream
+// NOTE: Pixels out of the region are decoded and dropped, pixels inside it are box-filtered by scale,
+// the only memory required besides the resulting image is one row of region pixels and accumulators
+static Image LoadImageRegionQOI(const unsigned char *fileData, int dataSize, Rectangle region, int scale)
+{
+    Image image = { 0 };
+
+    if ((dataSize < QOI_HEADER_SIZE + (int)sizeof(qoi_padding)) || (memcmp(fileData, "qoif", 4) != 0)) return image;
+
+    int p = 4;
+    unsigned int width = qoi_read_32(fileData, &p);
+    unsigned int height = qoi_read_32(fileData, &p);
+    int channels = fileData[12];
+
+    if ((width == 0) || (height == 0) || (channels < 3) || (channels > 4) || (height >= QOI_PIXELS_MAX/width)) return image;
+
+    ImageRegionFilter filter = { 0 };
+    if (!InitImageRegionFilter(&filter, (int)width, (int)height, channels, region, scale)) return image;
+
+    qoi_rgba_t index[64] = { 0 };
+    qoi_rgba_t px = { 0 };
+    px.rgba.a = 255;
+
+    int run = 0;
+    int chunksLen = dataSize - (int)sizeof(qoi_padding);
+
+    p = QOI_HEADER_SIZE;
+
+    for (int y = 0; y < (filter.y + filter.height); y++)
+    {
+        bool rowInRegion = (y >= filter.y);
+
+        for (int x = 0; x < (int)width; x++)
+        {
+            if (run > 0) run--;
+            else if (p < chunksLen)
+            {
+                int b1 = fileData[p++];
+
+                if (b1 == QOI_OP_RGB)
+                {
+                    px.rgba.r = fileData[p++];
+                    px.rgba.g = fileData[p++];
+                    px.rgba.b = fileData[p++];
+                }
+                else if (b1 == QOI_OP_RGBA)
+                {
+                    px.rgba.r = fileData[p++];
+                    px.rgba.g = fileData[p++];
+                    px.rgba.b = fileData[p++];
+                    px.rgba.a = fileData[p++];
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) px = index[b1];
+                else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF)
+                {
+                    px.rgba.r += ((b1 >> 4) & 0x03) - 2;
+                    px.rgba.g += ((b1 >> 2) & 0x03) - 2;
+                    px.rgba.b += (b1 & 0x03) - 2;
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA)
+                {
+                    int b2 = fileData[p++];
+                    int vg = (b1 & 0x3f) - 32;
+                    px.rgba.r += vg - 8 + ((b2 >> 4) & 0x0f);
+                    px.rgba.g += vg;
+                    px.rgba.b += vg - 8 + (b2 & 0x0f);
+                }
+                else if ((b1 & QOI_MASK_2) == QOI_OP_RUN) run = (b1 & 0x3f);
+
+                index[QOI_COLOR_HASH(px)%64] = px;
+            }
+
+            if (rowInRegion && (x >= filter.x) && (x < (filter.x + filter.width)))
+            {
+                unsigned char *dst = filter.row + (x - filter.x)*channels;
+
+                dst[0] = px.rgba.r;
+                dst[1] = px.rgba.g;
+                dst[2] = px.rgba.b;
+                if (channels == 4) dst[3] = px.rgba.a;
+            }
+        }
+
+        if (rowInRegion) AddImageRegionRow(&filter);
+    }
+
+    image = UnloadImageRegionFilter(&filter);
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Load image region from PNG data, inflating and unfiltering rows as a stream
+// NOTE: Decoding stops after the last region row, the only memory required besides the resulting image
+// is the inflate window, two source rows and one row of region pixels and accumulators,
+// image data split in multiple IDAT chunks is joined first (compressed size),
+// interlaced and CgBI (iOS optimized) images are not streamed and fall back to full decode
+static Image LoadImageRegionPNG(const unsigned char *fileData, int dataSize, Rectangle region, int scale)
+{
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+    Image image = { 0 };
+
+    if ((dataSize < 8) || (memcmp(fileData, signature, 8) != 0)) return image;
+
+    PNGRegionDecoder decoder = { 0 };
+    unsigned int width = 0;
+    unsigned int height = 0;
+    int interlace = 0;
+    int paletteCount = 0;
+    int dataOffset = 0;
+    int dataLength = 0;
+    int dataChunks = 0;
+    bool dataEnded = false;
+    bool fullDecode = false;
+    bool valid = false;
+
+    // Read chunks required for decoding
+    for (int p = 8; (p + 12) <= dataSize;)
+    {
+        unsigned int length = ((unsigned int)fileData[p] << 24) | (fileData[p + 1] << 16) | (fileData[p + 2] << 8) | fileData[p + 3];
+        const unsigned char *type = fileData + p + 4;
+        const unsigned char *chunk = fileData + p + 8;
+
+        if (length > (unsigned int)(dataSize - p - 12)) break;
+
+        if (memcmp(type, "IDAT", 4) == 0)
+        {
+            if (dataEnded || (length > (unsigned int)(INT_MAX - dataLength))) break;
+            if (dataChunks == 0) dataOffset = p;
+            dataLength += (int)length;
+            dataChunks++;
+        }
+        else if (dataChunks > 0) dataEnded = true;
+
+        if ((memcmp(type, "IHDR", 4) == 0) && (length == 13))
+        {
+            width = ((unsigned int)chunk[0] << 24) | (chunk[1] << 16) | (chunk[2] << 8) | chunk[3];
+            height = ((unsigned int)chunk[4] << 24) | (chunk[5] << 16) | (chunk[6] << 8) | chunk[7];
+            decoder.depth = chunk[8];
+            decoder.colorType = chunk[9];
+            interlace = chunk[12];
+        }
+        else if (memcmp(type, "CgBI", 4) == 0) fullDecode = true;
+        else if ((memcmp(type, "PLTE", 4) == 0) && (length <= 256*3) && ((length%3) == 0))
+        {
+            paletteCount = (int)length/3;
+
+            for (int i = 0; i < paletteCount; i++)
+            {
+                decoder.palette[i*4 + 0] = chunk[i*3 + 0];
+                decoder.palette[i*4 + 1] = chunk[i*3 + 1];
+                decoder.palette[i*4 + 2] = chunk[i*3 + 2];
+                decoder.palette[i*4 + 3] = 255;
+            }
+        }
+        else if (memcmp(type, "tRNS", 4) == 0)
+        {
+            decoder.transparency = true;
+
+            if (decoder.colorType == 3)
+            {
+                for (unsigned int i = 0; (i < length) && (i < 256); i++) decoder.palette[i*4 + 3] = chunk[i];
+            }
+            else
+            {
+                for (unsigned int i = 0; (i < length/2) && (i < 3); i++) decoder.transparent[i] = (unsigned short)((chunk[i*2] << 8) | chunk[i*2 + 1]);
+            }
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            valid = true;
+            break;
+        }
+
+        p += (int)length + 12;
+    }
+
+    int depth = decoder.depth;
+    int colorType = decoder.colorType;
+
+    if (!valid || (dataChunks == 0) || (width == 0) || (height == 0) || (width > STBI_MAX_DIMENSIONS) || (height > STBI_MAX_DIMENSIONS) ||
+        ((depth != 1) && (depth != 2) && (depth != 4) && (depth != 8) && (depth != 16)) ||
+        ((colorType != 0) && (colorType != 2) && (colorType != 3) && (colorType != 4) && (colorType != 6)) ||
+        ((colorType != 0) && (colorType != 3) && (depth < 8)) || ((colorType == 3) && ((depth == 16) || (paletteCount == 0))) ||
+        (decoder.transparency && ((colorType == 4) || (colorType == 6))) || (interlace > 1))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: PNG data not valid");
+        return image;
+    }
+
+    if (fullDecode || (interlace == 1)) return LoadImageRegionFull(".png", fileData, dataSize, region, scale);
+
+    // Transparent color keeps 16 bit samples, lower bit depths compare it scaled to 8 bit
+    if (depth < 16)
+    {
+        for (int i = 0; i < 3; i++) decoder.transparent[i] = (unsigned char)((decoder.transparent[i] & 255)*stbi__depth_scale_table[depth]);
+    }
+
+    // Resulting image channels match stb_image: palette expanded to RGB(A), tRNS color adds alpha channel
+    decoder.sourceChannels = (colorType == 3)? 1 : (((colorType & 2)? 3 : 1) + ((colorType & 4)? 1 : 0));
+    decoder.pixelBytes = MAX(1, decoder.sourceChannels*depth/8);
+    decoder.rowSize = 1 + (int)(((size_t)width*decoder.sourceChannels*depth + 7)/8);
+
+    int channels = (colorType == 3)? (decoder.transparency? 4 : 3) : (decoder.sourceChannels + (decoder.transparency? 1 : 0));
+
+    if (!InitImageRegionFilter(&decoder.filter, (int)width, (int)height, channels, region, scale)) return image;
+
+    // Join image data chunks if required, zlib stream must be contiguous
+    unsigned char *data = (unsigned char *)fileData + dataOffset + 8;
+
+    if (dataChunks > 1)
+    {
+        data = (unsigned char *)RL_MALLOC(dataLength);
+
+        for (int p = dataOffset, offset = 0; offset < dataLength;)
+        {
+            int length = (fileData[p] << 24) | (fileData[p + 1] << 16) | (fileData[p + 2] << 8) | fileData[p + 3];
+
+            memcpy(data + offset, fileData + p + 8, length);
+            offset += length;
+            p += length + 12;
+        }
+    }
+
+    decoder.window = (unsigned char *)RL_MALLOC(PNG_INFLATE_WINDOW_SIZE + PNG_INFLATE_CHUNK_SIZE);
+    decoder.flushed = decoder.window;
+    decoder.rowData = (unsigned char *)RL_MALLOC(decoder.rowSize);
+    decoder.prevRowData = (unsigned char *)RL_CALLOC(decoder.rowSize, 1);
+
+    decoder.zbuf.zbuffer = data;
+    decoder.zbuf.zbuffer_end = data + dataLength;
+    decoder.zbuf.zout_start = (char *)decoder.window;
+    decoder.zbuf.zout = (char *)decoder.window;
+    decoder.zbuf.zout_end = (char *)decoder.window + PNG_INFLATE_WINDOW_SIZE + PNG_INFLATE_CHUNK_SIZE;
+    decoder.zbuf.z_expandable = 0;
+
+    InflatePNGRegion(&decoder);
+
+    if (dataChunks > 1) RL_FREE(data);
+    RL_FREE(decoder.window);
+    RL_FREE(decoder.rowData);
+    RL_FREE(decoder.prevRowData);
+
+    image = UnloadImageRegionFilter(&decoder.filter);
+
+    if (image.data == NULL) TRACELOG(LOG_WARNING, "IMAGE: PNG data corrupted or incomplete");
+
+    return image;
+}
+
+// Inflate PNG image data zlib stream, decoded data is passed to rows through a sliding window
+// NOTE: Based on stb_image zlib decoder, only the last 32KB of output are kept for back-references,
+// inflating stops as soon as all region rows are decoded
+static bool InflatePNGRegion(PNGRegionDecoder *decoder)
+{
+    stbi__zbuf *zbuf = &decoder->zbuf;
+
+    if (!stbi__parse_zlib_header(zbuf)) return false;
+
+    zbuf->num_bits = 0;
+    zbuf->code_buffer = 0;
+    zbuf->hit_zeof_once = 0;
+
+    bool pending = true;
+    int final = 0;
+
+    while (pending && !final)
+    {
+        final = stbi__zreceive(zbuf, 1);
+        int type = stbi__zreceive(zbuf, 2);
+
+        if (type == 0)
+        {
+            // Stored block, header is byte aligned
+            unsigned char header[4] = { 0 };
+            int k = 0;
+
+            if (zbuf->num_bits & 7) stbi__zreceive(zbuf, zbuf->num_bits & 7);
+            while ((zbuf->num_bits > 0) && (k < 4))
+            {
+                header[k++] = (unsigned char)(zbuf->code_buffer & 255);
+                zbuf->code_buffer >>= 8;
+                zbuf->num_bits -= 8;
+            }
+            if (zbuf->num_bits != 0) return false;
+            while (k < 4) header[k++] = stbi__zget8(zbuf);
+
+            int length = header[1]*256 + header[0];
+            int lengthCheck = header[3]*256 + header[2];
+
+            if ((lengthCheck != (length ^ 0xffff)) || (length > (zbuf->zbuffer_end - zbuf->zbuffer))) return false;
+
+            while (length > 0)
+            {
+                if (zbuf->zout == zbuf->zout_end)
+                {
+                    pending = FlushPNGRegionWindow(decoder);
+                    if (!pending) break;
+                }
+
+                int count = MIN(length, (int)(zbuf->zout_end - zbuf->zout));
+
+                memcpy(zbuf->zout, zbuf->zbuffer, count);
+                zbuf->zbuffer += count;
+                zbuf->zout += count;
+                length -= count;
+            }
+        }
+        else if (type == 3) return false;
+        else
+        {
+            if (type == 1)
+            {
+                if (!stbi__zbuild_huffman(&zbuf->z_length, stbi__zdefault_length, STBI__ZNSYMS)) return false;
+                if (!stbi__zbuild_huffman(&zbuf->z_distance, stbi__zdefault_distance, 32)) return false;
+            }
+            else if (!stbi__compute_huffman_codes(zbuf)) return false;
+
+            char *zout = zbuf->zout;
+
+            while (true)
+            {
+                // Make room for the longest match
+                if ((zbuf->zout_end - zout) < 258)
+                {
+                    zbuf->zout = zout;
+                    pending = FlushPNGRegionWindow(decoder);
+                    zout = zbuf->zout;
+                    if (!pending) break;
+                }
+
+                int code = stbi__zhuffman_decode(zbuf, &zbuf->z_length);
+
+                if (code < 0) return false;
+                else if (code < 256) *zout++ = (char)code;
+                else if (code == 256)
+                {
+                    if (zbuf->hit_zeof_once && (zbuf->num_bits < 16)) return false;
+                    break;
+                }
+                else
+                {
+                    if (code >= 286) return false;
+
+                    code -= 257;
+                    int length = stbi__zlength_base[code];
+                    if (stbi__zlength_extra[code]) length += stbi__zreceive(zbuf, stbi__zlength_extra[code]);
+
+                    code = stbi__zhuffman_decode(zbuf, &zbuf->z_distance);
+                    if ((code < 0) || (code >= 30)) return false;
+
+                    int distance = stbi__zdist_base[code];
+                    if (stbi__zdist_extra[code]) distance += stbi__zreceive(zbuf, stbi__zdist_extra[code]);
+                    if ((zout - zbuf->zout_start) < distance) return false;
+
+                    const char *src = zout - distance;
+                    while (length-- > 0) *zout++ = *src++;
+                }
+            }
+
+            zbuf->zout = zout;
+        }
+    }
+
+    if (pending) FlushPNGRegionWindow(decoder);
+
+    return true;
+}
+
+// Pass inflated bytes to rows and slide window, keeping the deflate back-references range
+// NOTE: Returns false once all region rows are decoded
+static bool FlushPNGRegionWindow(PNGRegionDecoder *decoder)
+{
+    stbi__zbuf *zbuf = &decoder->zbuf;
+    bool pending = AddPNGRegionData(decoder, decoder->flushed, (int)((unsigned char *)zbuf->zout - decoder->flushed));
+
+    if ((zbuf->zout - zbuf->zout_start) > PNG_INFLATE_WINDOW_SIZE)
+    {
+        memmove(zbuf->zout_start, zbuf->zout - PNG_INFLATE_WINDOW_SIZE, PNG_INFLATE_WINDOW_SIZE);
+        zbuf->zout = zbuf->zout_start + PNG_INFLATE_WINDOW_SIZE;
+    }
+
+    decoder->flushed = (unsigned char *)zbuf->zout;
+
+    return pending;
+}
+
+// Add inflated bytes to PNG rows, unfiltered rows inside region are converted to 8 bit channels
+// NOTE: Returns false once all region rows are decoded or data is not valid
+static bool AddPNGRegionData(PNGRegionDecoder *decoder, const unsigned char *data, int size)
+{
+    ImageRegionFilter *filter = &decoder->filter;
+    int lastRow = filter->y + filter->height;
+
+    while ((size > 0) && (decoder->y < lastRow))
+    {
+        int count = MIN(size, decoder->rowSize - decoder->rowFill);
+
+        memcpy(decoder->rowData + decoder->rowFill, data, count);
+        decoder->rowFill += count;
+        data += count;
+        size -= count;
+
+        if (decoder->rowFill < decoder->rowSize) break;
+
+        // Unfilter row, previous row starts zeroed so first row filters need no special case
+        unsigned char *row = decoder->rowData + 1;
+        const unsigned char *prior = decoder->prevRowData + 1;
+        int length = decoder->rowSize - 1;
+        int bpp = decoder->pixelBytes;
+
+        switch (decoder->rowData[0])
+        {
+            case 0: break;
+            case 1: for (int i = bpp; i < length; i++) row[i] += row[i - bpp]; break;
+            case 2: for (int i = 0; i < length; i++) row[i] += prior[i]; break;
+            case 3:
+            {
+                for (int i = 0; i < bpp; i++) row[i] += prior[i] >> 1;
+                for (int i = bpp; i < length; i++) row[i] += (row[i - bpp] + prior[i]) >> 1;
+            } break;
+            case 4:
+            {
+                for (int i = 0; i < bpp; i++) row[i] += prior[i];
+                for (int i = bpp; i < length; i++) row[i] += (unsigned char)stbi__paeth(row[i - bpp], prior[i], prior[i - bpp]);
+            } break;
+            default: return false;
+        }
+
+        if (decoder->y >= filter->y)
+        {
+            int depth = decoder->depth;
+            int sourceChannels = decoder->sourceChannels;
+
+            for (int i = 0; i < filter->width; i++)
+            {
+                int x = filter->x + i;
+                unsigned char *dst = filter->row + i*filter->channels;
+                unsigned short samples[4] = { 0 };
+
+                for (int c = 0; c < sourceChannels; c++)
+                {
+                    if (depth == 16) samples[c] = (unsigned short)((row[(x*sourceChannels + c)*2] << 8) | row[(x*sourceChannels + c)*2 + 1]);
+                    else if (depth == 8) samples[c] = row[x*sourceChannels + c];
+                    else
+                    {
+                        int bit = x*depth;
+                        samples[c] = (row[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+                    }
+                }
+
+                if (decoder->colorType == 3) memcpy(dst, decoder->palette + samples[0]*4, filter->channels);
+                else
+                {
+                    bool transparent = decoder->transparency;
+
+                    for (int c = 0; c < sourceChannels; c++)
+                    {
+                        // NOTE: 16 bit samples keep the high byte, lower bit depths are scaled to [0..255]
+                        dst[c] = (depth == 16)? (unsigned char)(samples[c] >> 8) : (unsigned char)(samples[c]*stbi__depth_scale_table[depth]);
+
+                        if (transparent) transparent = ((depth == 16)? samples[c] : dst[c]) == decoder->transparent[c];
+                    }
+
+                    if (decoder->transparency) dst[sourceChannels] = transparent? 0 : 255;
+                }
+            }
+
+            AddImageRegionRow(filter);
+        }
+
+        unsigned char *swap = decoder->prevRowData;
+        decoder->prevRowData = decoder->rowData;
+        decoder->rowData = swap;
+        decoder->rowFill = 0;
+        decoder->y++;
+    }
+
+    return (decoder->y < lastRow);
+}
+#endif
+
+// Load image region decoding the full image, then cropped and scaled down
+// NOTE: Used by file formats without streaming decode, stb_image formats over
+// IMAGE_REGION_MAX_DECODE_PIXELS are rejected (no scaled down decoding available)
+static Image LoadImageRegionFull(const char *fileType, const unsigned char *fileData, int dataSize, Rectangle region, int scale)
+{
+    Image image = { 0 };
+
+#if defined(STBI_REQUIRED)
+    int width = 0;
+    int height = 0;
+    int comp = 0;
+
+    if (stbi_info_from_memory(fileData, dataSize, &width, &height, &comp) && (((long long)width*height) > IMAGE_REGION_MAX_DECODE_PIXELS))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Region loading requires full decode of %s data, image too big (%ix%i), limit is %i pixels", fileType, width, height, IMAGE_REGION_MAX_DECODE_PIXELS);
+        return image;
+    }
+#endif
+
+    TRACELOG(LOG_INFO, "IMAGE: Region loading requires full decode of %s data", fileType);
+
+    image = LoadImageFromMemory(fileType, fileData, dataSize);
+
+    if (image.data != NULL)
+    {
+        if ((region.width > 0) && (region.height > 0)) ImageCrop(&image, region);
+        if (scale > 1) ImageResize(&image, MAX(1, image.width/scale), MAX(1, image.height/scale));
+    }
+
+    return image;
+}
+
+// Generate cubemap faces mipmaps (vertical line layout), levels count depends on face size
+// NOTE: Every face is filtered on its own, generated levels store the 6 faces one after the other,
+// as expected by rlLoadTextureCubemap(), compressed formats not supported
+static void GenImageCubemapMipmaps(Image *faces)
+{
+    int size = faces->width;
+    int mipCount = 1;
+    while ((size >> mipCount) > 0) mipCount++;
+
+    if ((mipCount <= faces->mipmaps) || (faces->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    int dataSize = 0;
+    for (int level = 0; level < mipCount; level++) dataSize += GetPixelDataSize(size >> level, size >> level, faces->format)*6;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    int faceDataSize = GetPixelDataSize(size, size, faces->format);
+
+    for (int face = 0; face < 6; face++)
+    {
+        Image faceImage = { RL_MALLOC(faceDataSize), size, size, 1, faces->format };
+        memcpy(faceImage.data, (unsigned char *)faces->data + (size_t)face*faceDataSize, faceDataSize);
+
+        ImageMipmaps(&faceImage);
+
+        unsigned char *levelData = data;
+        unsigned char *faceLevelData = (unsigned char *)faceImage.data;
+
+        for (int level = 0; level < faceImage.mipmaps; level++)
+        {
+            int levelFaceSize = GetPixelDataSize(size >> level, size >> level, faces->format);
+
+            memcpy(levelData + (size_t)face*levelFaceSize, faceLevelData, levelFaceSize);
+            levelData += levelFaceSize*6;
+            faceLevelData += levelFaceSize;
+        }
+
+        UnloadImage(faceImage);
+    }
+
+    RL_FREE(faces->data);
+    faces->data = data;
+    faces->mipmaps = mipCount;
+}
+
+// Load virtual texture page into cache slot, page pixels are copied with a border (clamped to level edges)
+static void LoadVirtualTexturePage(VirtualTexture texture, int page, int slot)
+{
+    rVirtualTextureData *data = texture.data;
+
+    int level = data->levelCount - 1;
+    while (page < data->levelOffset[level]) level--;
+
+    Image source = data->levels[level];
+    int pageX = (page - data->levelOffset[level])%data->levelPagesX[level];
+    int pageY = (page - data->levelOffset[level])/data->levelPagesX[level];
+    int physicalPageSize = data->pageSize + 2*VIRTUAL_TEXTURE_PAGE_BORDER;
+    int startX = pageX*data->pageSize - VIRTUAL_TEXTURE_PAGE_BORDER;
+    int startY = pageY*data->pageSize - VIRTUAL_TEXTURE_PAGE_BORDER;
+
+    for (int y = 0; y < physicalPageSize; y++)
+    {
+        int sourceY = MIN(MAX(startY + y, 0), source.height - 1);
+        const unsigned int *sourceRow = (const unsigned int *)source.data + (size_t)sourceY*source.width;
+        unsigned int *row = (unsigned int *)data->pageBuffer + y*physicalPageSize;
+
+        for (int x = 0; x < physicalPageSize; x++) row[x] = sourceRow[MIN(MAX(startX + x, 0), source.width - 1)];
+    }
+
+    rlUpdateTexture(texture.cache.id, (slot%data->slotsX)*physicalPageSize, (slot/data->slotsX)*physicalPageSize,
+        physicalPageSize, physicalPageSize, texture.cache.format, data->pageBuffer);
+
+    data->pageSlot[page] = slot;
+    data->slotPage[slot] = page;
 }
 
-// Get color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
+// Update virtual texture indirection table (RAM), every base level page points to finest resident page covering it
+static void UpdateVirtualTextureIndirection(VirtualTexture texture)
 {
-    Vector4 result;
+    rVirtualTextureData *data = texture.data;
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+    int tableWidth = data->levelPagesX[0];
+    int tableHeight = data->levelPagesY[0];
 
-    return result;
+    for (int level = data->levelCount - 1; level >= 0; level--)
+    {
+        for (int pageY = 0; pageY < data->levelPagesY[level]; pageY++)
+        {
+            for (int pageX = 0; pageX < data->levelPagesX[level]; pageX++)
+            {
+                int slot = data->pageSlot[data->levelOffset[level] + pageY*data->levelPagesX[level] + pageX];
+
+                if (slot < 0) continue;
+
+                unsigned char entry[4] = { (unsigned char)(slot%data->slotsX), (unsigned char)(slot/data->slotsX), (unsigned char)level, 255 };
+
+                for (int y = (pageY << level); y < MIN((pageY + 1) << level, tableHeight); y++)
+                {
+                    for (int x = (pageX << level); x < MIN((pageX + 1) << level, tableWidth); x++) memcpy(data->indirection + ((size_t)y*tableWidth + x)*4, entry, 4);
+                }
+            }
+        }
+    }
+}
+
+// Compare virtual texture pages for sorting, coarser levels first
+static int CompareVirtualTexturePages(const void *a, const void *b)
+{
+    return (*(const int *)b - *(const int *)a);
+}
+
+// Generate mipmap level from previous level with a 2x2 box filter, 8-bit per channel pixel data
+// NOTE 1: Odd sizes fold last source row/column into the edge texels (3 samples), no source pixel is dropped
+// NOTE 2: sRGB color channels are averaged in linear space, using stb_image_resize2 constant conversion tables
+// NOTE 3: A box filter is enough for 2:1 reductions of previous level, wider kernels (i.e. Kaiser) are not provided
+// NOTE 4: Level rows are independent, big levels are split in bands of rows between threads
+static void GenImageMipmapLevel(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, int alphaIndex, bool sRGB)
+{
+    ImageMipmapLevel level = { src, srcWidth, srcHeight, dst, dstWidth, dstHeight, channels, alphaIndex, sRGB };
+
+    // NOTE: Every generated texel reads 4 source pixels
+    ProcessImageItems(GenImageMipmapRows, &level, dstHeight, dstWidth*4);
+}
+
+// Generate mipmap level rows range
+static void GenImageMipmapRows(void *data, int start, int end)
+{
+    ImageMipmapLevel *level = (ImageMipmapLevel *)data;
+    const unsigned char *src = level->src;
+    int srcWidth = level->srcWidth;
+    int srcHeight = level->srcHeight;
+    unsigned char *dst = level->dst;
+    int dstWidth = level->dstWidth;
+    int dstHeight = level->dstHeight;
+    int channels = level->channels;
+    int alphaIndex = level->alphaIndex;
+    bool sRGB = level->sRGB;
+
+    int srcRowSize = srcWidth*channels;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *rows[3] = {
+            src + (size_t)MIN(2*y, srcHeight - 1)*srcRowSize,
+            src + (size_t)MIN(2*y + 1, srcHeight - 1)*srcRowSize,
+            src + (size_t)MIN(2*y + 2, srcHeight - 1)*srcRowSize
+        };
+        int rowCount = ((y == (dstHeight - 1)) && (srcHeight > 2*dstHeight))? 3 : 2;
+        unsigned char *dstRow = dst + (size_t)y*dstWidth*channels;
+
+        for (int x = 0; x < dstWidth; x++)
+        {
+            int offsets[3] = { MIN(2*x, srcWidth - 1)*channels, MIN(2*x + 1, srcWidth - 1)*channels, MIN(2*x + 2, srcWidth - 1)*channels };
+            int colCount = ((x == (dstWidth - 1)) && (srcWidth > 2*dstWidth))? 3 : 2;
+
+            if ((rowCount == 2) && (colCount == 2))
+            {
+                const unsigned char *row0 = rows[0];
+                const unsigned char *row1 = rows[1];
+                int offset0 = offsets[0];
+                int offset1 = offsets[1];
+
+                for (int c = 0; c < channels; c++)
+                {
+                    if (sRGB && (c != alphaIndex))
+                    {
+                        float linear = stbir__srgb_uchar_to_linear_float[row0[offset0 + c]] + stbir__srgb_uchar_to_linear_float[row0[offset1 + c]] +
+                                       stbir__srgb_uchar_to_linear_float[row1[offset0 + c]] + stbir__srgb_uchar_to_linear_float[row1[offset1 + c]];
+                        dstRow[x*channels + c] = stbir__linear_to_srgb_uchar(linear*0.25f);
+                    }
+                    else dstRow[x*channels + c] = (unsigned char)((row0[offset0 + c] + row0[offset1 + c] + row1[offset0 + c] + row1[offset1 + c] + 2) >> 2);
+                }
+            }
+            else
+            {
+                // Edge texel on odd sizes, 2x3, 3x2 or 3x3 samples
+                int sampleCount = rowCount*colCount;
+
+                for (int c = 0; c < channels; c++)
+                {
+                    if (sRGB && (c != alphaIndex))
+                    {
+                        float linear = 0.0f;
+                        for (int j = 0; j < rowCount; j++) for (int i = 0; i < colCount; i++) linear += stbir__srgb_uchar_to_linear_float[rows[j][offsets[i] + c]];
+                        dstRow[x*channels + c] = stbir__linear_to_srgb_uchar(linear/sampleCount);
+                    }
+                    else
+                    {
+                        int sum = 0;
+                        for (int j = 0; j < rowCount; j++) for (int i = 0; i < colCount; i++) sum += rows[j][offsets[i] + c];
+                        dstRow[x*channels + c] = (unsigned char)((sum + sampleCount/2)/sampleCount);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Get image alpha test coverage: fraction of pixels passing alpha reference with alpha scaled
+static float GetImageAlphaCoverage(const unsigned char *data, int pixelCount, int channels, int alphaIndex, float reference, float scale)
+{
+    int count = 0;
+    float threshold = reference*255.0f;
+
+    for (int i = 0; i < pixelCount; i++) if ((data[i*channels + alphaIndex]*scale) > threshold) count++;
+
+    return (float)count/(float)pixelCount;
+}
+
+// Scale image alpha to match provided alpha test coverage
+static void ScaleImageAlphaCoverage(unsigned char *data, int pixelCount, int channels, int alphaIndex, float reference, float coverage)
+{
+    float minScale = 0.0f;
+    float maxScale = 4.0f;
+    float scale = 1.0f;
+    float bestScale = 1.0f;
+    float bestError = 2.0f;
+
+    // Binary search of the alpha scale giving the closest coverage
+    for (int i = 0; i < 10; i++)
+    {
+        float currentCoverage = GetImageAlphaCoverage(data, pixelCount, channels, alphaIndex, reference, scale);
+        float error = fabsf(currentCoverage - coverage);
+
+        if (error < bestError)
+        {
+            bestError = error;
+            bestScale = scale;
+        }
+
+        if (currentCoverage < coverage) minScale = scale;
+        else if (currentCoverage > coverage) maxScale = scale;
+        else break;
+
+        scale = (minScale + maxScale)/2.0f;
+    }
+
+    for (int i = 0; i < pixelCount; i++)
+    {
+        unsigned char *alpha = &data[i*channels + alphaIndex];
+        *alpha = (unsigned char)fminf(*alpha*bestScale + 0.5f, 255.0f);
+    }
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate radial gradient rows range
+static void GenImageGradientRadialRows(void *data, int start, int end)
+{
+    ImageGeneration *generation = (ImageGeneration *)data;
+    Color *pixels = generation->pixels;
+    int width = generation->width;
+    int height = generation->height;
+    float density = generation->density;
+    Color inner = generation->inner;
+    Color outer = generation->outer;
+
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+
+    float centerX = (float)width/2.0f;
+    float centerY = (float)height/2.0f;
+
+    // Squared distances limits, sqrt is only required for pixels in the gradient band
+    float innerRadius = radius*density;
+    float innerRadiusSqr = innerRadius*innerRadius;
+    float outerRadiusSqr = radius*radius;
+
+    for (int y = start; y < end; y++)
+    {
+        float distY = (float)y - centerY;
+        float distYSqr = distY*distY;
+        float distX = -centerX;
+
+        for (int x = 0; x < width; x++, distX += 1.0f)
+        {
+            float distSqr = distX*distX + distYSqr;
+
+            if (distSqr <= innerRadiusSqr) pixels[y*width + x] = inner;
+            else if (distSqr >= outerRadiusSqr) pixels[y*width + x] = outer;
+            else
+            {
+                float factor = (sqrtf(distSqr) - innerRadius)/(radius*(1.0f - density));
+
+                factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+
+                pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+                pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+                pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+                pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+            }
+        }
+    }
+}
+
+// Generate square gradient rows range
+static void GenImageGradientSquareRows(void *data, int start, int end)
+{
+    ImageGeneration *generation = (ImageGeneration *)data;
+    Color *pixels = generation->pixels;
+    int width = generation->width;
+    float density = generation->density;
+    Color inner = generation->inner;
+    Color outer = generation->outer;
+    const float *normalizedDistX = generation->samplesX;
+
+    float centerY = (float)generation->height/2.0f;
+
+    for (int y = start; y < end; y++)
+    {
+        // Normalize the distances by the dimensions of the gradient rectangle
+        float normalizedDistY = fabsf(y - centerY)/centerY;
+
+        for (int x = 0; x < width; x++)
+        {
+            // Calculate the total normalized Manhattan distance
+            float manhattanDist = fmaxf(normalizedDistX[x], normalizedDistY);
+
+            // Subtract the density from the manhattanDist, then divide by (1 - density)
+            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
+            float factor = (manhattanDist - density)/(1.0f - density);
+
+            // Clamp the factor between 0 and 1
+            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+
+            // Blend the colors based on the calculated factor
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate perlin noise rows range
+static void GenImagePerlinNoiseRows(void *data, int start, int end)
+{
+    ImageGeneration *generation = (ImageGeneration *)data;
+    Color *pixels = generation->pixels;
+    int width = generation->width;
+    int height = generation->height;
+    float scale = generation->scale;
+
+    float aspectRatio = (float)width/(float)height;
+    float *values = (float *)RL_MALLOC(width*sizeof(float));
+
+    for (int y = start; y < end; y++)
+    {
+        float ny = (float)(y + generation->offsetY)*(scale/(float)height);
+        if (width <= height) ny /= aspectRatio;
+
+        // Calculate perlin noise using fbm (fractal brownian motion), same as stb_perlin_fbm_noise3()
+        // Octaves are evaluated for the full row at once, reusing lattice data along the row
+        // Typical values to start playing with:
+        //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+        //   gain       =  0.5   -- relative weighting applied to each successive octave
+        //   octaves    =  6     -- number of "octaves" of noise3() to sum
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+
+        memset(values, 0, width*sizeof(float));
+
+        for (int octave = 0; octave < 6; octave++)
+        {
+            AddPerlinNoiseRow(values, generation->samplesX, width, frequency, ny*frequency, 1.0f*frequency, (unsigned char)octave, amplitude);
+            frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            float p = values[x];
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+
+    RL_FREE(values);
+}
+
+// Add perlin noise octave to a row of values, equivalent to stb_perlin_noise3() evaluated per sample
+// NOTE: Lattice hashes and gradients only change when samples cross a lattice cell, they are reused along the row
+static void AddPerlinNoiseRow(float *values, const float *samplesX, int count, float frequency, float y, float z, unsigned char seed, float amplitude)
+{
+    int py = stb__perlin_fastfloor(y);
+    int pz = stb__perlin_fastfloor(z);
+    int y0 = py & 255, y1 = (py + 1) & 255;
+    int z0 = pz & 255, z1 = (pz + 1) & 255;
+
+    y -= py;
+    z -= pz;
+    float v = stb__perlin_ease(y);
+    float w = stb__perlin_ease(z);
+
+    // Corners gradients, split into x component and (y, z) contribution
+    float gradX[8] = { 0 };
+    float gradYZ[8] = { 0 };
+    int prevPx = INT_MIN;
+
+    for (int i = 0; i < count; i++)
+    {
+        float x = samplesX[i]*frequency;
+        int px = stb__perlin_fastfloor(x);
+
+        if (px != prevPx)
+        {
+            int r0 = stb__perlin_randtab[(px & 255) + seed];
+            int r1 = stb__perlin_randtab[((px + 1) & 255) + seed];
+            int corners[8] = {
+                stb__perlin_randtab_grad_idx[stb__perlin_randtab[r0 + y0] + z0], stb__perlin_randtab_grad_idx[stb__perlin_randtab[r0 + y0] + z1],
+                stb__perlin_randtab_grad_idx[stb__perlin_randtab[r0 + y1] + z0], stb__perlin_randtab_grad_idx[stb__perlin_randtab[r0 + y1] + z1],
+                stb__perlin_randtab_grad_idx[stb__perlin_randtab[r1 + y0] + z0], stb__perlin_randtab_grad_idx[stb__perlin_randtab[r1 + y0] + z1],
+                stb__perlin_randtab_grad_idx[stb__perlin_randtab[r1 + y1] + z0], stb__perlin_randtab_grad_idx[stb__perlin_randtab[r1 + y1] + z1]
+            };
+
+            // NOTE: Gradients have a zero component, so splitting the dot product does not change the result
+            for (int c = 0; c < 8; c++)
+            {
+                gradX[c] = stb__perlin_grad(corners[c], 1.0f, 0.0f, 0.0f);
+                gradYZ[c] = stb__perlin_grad(corners[c], 0.0f, (c & 2)? y - 1 : y, (c & 1)? z - 1 : z);
+            }
+
+            prevPx = px;
+        }
+
+        x -= px;
+        float u = stb__perlin_ease(x);
+
+        float n00 = stb__perlin_lerp(gradX[0]*x + gradYZ[0], gradX[1]*x + gradYZ[1], w);
+        float n01 = stb__perlin_lerp(gradX[2]*x + gradYZ[2], gradX[3]*x + gradYZ[3], w);
+        float n10 = stb__perlin_lerp(gradX[4]*(x - 1) + gradYZ[4], gradX[5]*(x - 1) + gradYZ[5], w);
+        float n11 = stb__perlin_lerp(gradX[6]*(x - 1) + gradYZ[6], gradX[7]*(x - 1) + gradYZ[7], w);
+
+        float n0 = stb__perlin_lerp(n00, n01, v);
+        float n1 = stb__perlin_lerp(n10, n11, v);
+
+        values[i] += stb__perlin_lerp(n0, n1, u)*amplitude;
+    }
+}
+
+// Generate cellular rows range
+static void GenImageCellularRows(void *data, int start, int end)
+{
+    ImageGeneration *generation = (ImageGeneration *)data;
+    Color *pixels = generation->pixels;
+    const int *seeds = generation->seeds;
+    int width = generation->width;
+    int height = generation->height;
+    int tileSize = generation->tileSize;
+
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+
+    int neighbors[9*2] = { 0 };     // Seeds of adjacent tiles, gathered once per tile
+    int neighborCount = 0;
+
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+        int prevTileX = -2;
+
+        for (int x = 0; x < width; x++)
+        {
+            int tileX = x/tileSize;
+
+            // Gather all adjacent tiles seeds
+            if (tileX != prevTileX)
+            {
+                neighborCount = 0;
+
+                for (int i = -1; i < 2; i++)
+                {
+                    if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                    for (int j = -1; j < 2; j++)
+                    {
+                        if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+
+                        neighbors[neighborCount*2] = seeds[((tileY + j)*seedsPerRow + tileX + i)*2];
+                        neighbors[neighborCount*2 + 1] = seeds[((tileY + j)*seedsPerRow + tileX + i)*2 + 1];
+                        neighborCount++;
+                    }
+                }
+
+                prevTileX = tileX;
+            }
+
+            // Compare squared distances, only nearest seed distance requires sqrt
+            int minDistanceSqr = INT_MAX;
+
+            for (int i = 0; i < neighborCount; i++)
+            {
+                int distX = x - neighbors[i*2];
+                int distY = y - neighbors[i*2 + 1];
+                int distSqr = distX*distX + distY*distY;
+
+                if (distSqr < minDistanceSqr) minDistanceSqr = distSqr;
+            }
+
+            float minDistance = (minDistanceSqr == INT_MAX)? 65536.0f : sqrtf((float)minDistanceSqr);
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+
+}
+
+// Generate cubemap faces rows range from equirectangular panorama (bilinear)
+static void GenCubemapPanoramaRows(void *data, int start, int end)
+{
+    CubemapGeneration *generation = (CubemapGeneration *)data;
+    const Vector4 *pixels = generation->pixels;
+    Vector4 *faces = generation->faces;
+    int size = generation->size;
+    int panoramaWidth = generation->sourceWidth;
+    int panoramaHeight = generation->sourceHeight;
+
+    for (int row = start; row < end; row++)
+    {
+        int face = row/size;
+        int y = row%size;
+
+        for (int x = 0; x < size; x++)
+        {
+            Vector3 direction = GetCubemapTexelDirection(face, x, y, size);
+
+            // Direction to equirectangular coordinates (pixels)
+            float u = (0.5f + atan2f(direction.z, direction.x)/(2.0f*PI))*panoramaWidth - 0.5f;
+            float v = (0.5f - asinf(direction.y)/PI)*panoramaHeight - 0.5f;
+
+            int x0 = (int)floorf(u);
+            int y0 = (int)floorf(v);
+            float fx = u - x0;
+            float fy = v - y0;
+
+            // Wrap horizontally, clamp vertically
+            int x1 = (x0 + 1 + panoramaWidth)%panoramaWidth;
+            x0 = (x0 + panoramaWidth)%panoramaWidth;
+            int y1 = MIN(MAX(y0 + 1, 0), panoramaHeight - 1);
+            y0 = MIN(MAX(y0, 0), panoramaHeight - 1);
+
+            Vector4 c00 = pixels[y0*panoramaWidth + x0];
+            Vector4 c10 = pixels[y0*panoramaWidth + x1];
+            Vector4 c01 = pixels[y1*panoramaWidth + x0];
+            Vector4 c11 = pixels[y1*panoramaWidth + x1];
+            Vector4 *result = &faces[((size_t)face*size + y)*size + x];
+
+            result->x = (c00.x*(1 - fx) + c10.x*fx)*(1 - fy) + (c01.x*(1 - fx) + c11.x*fx)*fy;
+            result->y = (c00.y*(1 - fx) + c10.y*fx)*(1 - fy) + (c01.y*(1 - fx) + c11.y*fx)*fy;
+            result->z = (c00.z*(1 - fx) + c10.z*fx)*(1 - fy) + (c01.z*(1 - fx) + c11.z*fx)*fy;
+            result->w = (c00.w*(1 - fx) + c10.w*fx)*(1 - fy) + (c01.w*(1 - fx) + c11.w*fx)*fy;
+        }
+    }
+}
+
+// Project cubemap faces rows range into spherical harmonics, 9 coefficients per row
+// NOTE: Every texel is weighted by its solid angle
+static void ProjectCubemapIrradianceRows(void *data, int start, int end)
+{
+    CubemapGeneration *generation = (CubemapGeneration *)data;
+    int sourceSize = generation->sourceWidth;
+    float basis[9] = { 0 };
+
+    for (int row = start; row < end; row++)
+    {
+        int face = row/sourceSize;
+        int y = row%sourceSize;
+        float v = 2.0f*(y + 0.5f)/sourceSize - 1.0f;
+        Vector3 *coeffs = generation->coeffs + (size_t)row*9;
+
+        for (int x = 0; x < sourceSize; x++)
+        {
+            float u = 2.0f*(x + 0.5f)/sourceSize - 1.0f;
+            float texelSolidAngle = (4.0f/((float)sourceSize*sourceSize))/powf(1.0f + u*u + v*v, 1.5f);
+
+            GetSphericalHarmonicsBasis(GetCubemapTexelDirection(face, x, y, sourceSize), basis);
+
+            Vector4 color = generation->pixels[(size_t)row*sourceSize + x];
+
+            for (int i = 0; i < 9; i++)
+            {
+                coeffs[i].x += color.x*basis[i]*texelSolidAngle;
+                coeffs[i].y += color.y*basis[i]*texelSolidAngle;
+                coeffs[i].z += color.z*basis[i]*texelSolidAngle;
+            }
+        }
+    }
+}
+
+// Generate irradiance cubemap faces rows range from convolved spherical harmonics coefficients
+static void GenCubemapIrradianceRows(void *data, int start, int end)
+{
+    CubemapGeneration *generation = (CubemapGeneration *)data;
+    const Vector3 *coeffs = generation->coeffs;
+    int size = generation->size;
+    float basis[9] = { 0 };
+
+    for (int row = start; row < end; row++)
+    {
+        int face = row/size;
+        int y = row%size;
+
+        for (int x = 0; x < size; x++)
+        {
+            GetSphericalHarmonicsBasis(GetCubemapTexelDirection(face, x, y, size), basis);
+
+            Vector4 result = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+            for (int i = 0; i < 9; i++)
+            {
+                result.x += coeffs[i].x*basis[i];
+                result.y += coeffs[i].y*basis[i];
+                result.z += coeffs[i].z*basis[i];
+            }
+
+            result.x = fmaxf(result.x, 0.0f);
+            result.y = fmaxf(result.y, 0.0f);
+            result.z = fmaxf(result.z, 0.0f);
+
+            generation->faces[(size_t)row*size + x] = result;
+        }
+    }
+}
+
+// Generate prefiltered cubemap level faces rows range (GGX importance sampling)
+static void GenCubemapPrefilterRows(void *data, int start, int end)
+{
+    CubemapGeneration *generation = (CubemapGeneration *)data;
+    Vector4 *faces = generation->faces;
+    int levelSize = generation->size;
+    Vector4 **sourceMips = generation->sourceMips;
+    int sourceSize = generation->sourceWidth;
+    int sourceLevels = generation->sourceLevels;
+    float alphaSqr = generation->alphaSqr;
+    int sampleCount = generation->sampleCount;
+    float sourceTexelSolidAngle = 4.0f*PI/(6.0f*sourceSize*sourceSize);
+
+    for (int row = start; row < end; row++)
+    {
+        int face = row/levelSize;
+        int y = row%levelSize;
+
+        for (int x = 0; x < levelSize; x++)
+        {
+            Vector3 normal = GetCubemapTexelDirection(face, x, y, levelSize);
+            Vector4 result = { 0 };
+            float totalWeight = 0.0f;
+
+            if (sampleCount == 1)
+            {
+                result = SampleCubemapNormalized(sourceMips[0], sourceSize, normal);
+                totalWeight = 1.0f;
+            }
+            else
+            {
+                // Tangent space basis around normal (view direction is assumed equal to normal)
+                Vector3 up = (fabsf(normal.z) < 0.999f)? (Vector3){ 0.0f, 0.0f, 1.0f } : (Vector3){ 1.0f, 0.0f, 0.0f };
+                Vector3 tangentX = { up.y*normal.z - up.z*normal.y, up.z*normal.x - up.x*normal.z, up.x*normal.y - up.y*normal.x };
+                float length = sqrtf(tangentX.x*tangentX.x + tangentX.y*tangentX.y + tangentX.z*tangentX.z);
+                tangentX = (Vector3){ tangentX.x/length, tangentX.y/length, tangentX.z/length };
+                Vector3 tangentY = { normal.y*tangentX.z - normal.z*tangentX.y, normal.z*tangentX.x - normal.x*tangentX.z, normal.x*tangentX.y - normal.y*tangentX.x };
+
+                for (int i = 0; i < sampleCount; i++)
+                {
+                    // Hammersley point set, importance sampling GGX half vector
+                    unsigned int bits = (unsigned int)i;
+                    bits = (bits << 16u) | (bits >> 16u);
+                    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+                    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+                    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+                    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+
+                    float e1 = (float)i/sampleCount;
+                    float e2 = (float)bits*2.3283064365386963e-10f;
+
+                    float phi = 2.0f*PI*e1;
+                    float cosTheta = sqrtf((1.0f - e2)/(1.0f + (alphaSqr - 1.0f)*e2));
+                    float sinTheta = sqrtf(1.0f - cosTheta*cosTheta);
+
+                    float hx = sinTheta*cosf(phi);
+                    float hy = sinTheta*sinf(phi);
+                    Vector3 half = {
+                        tangentX.x*hx + tangentY.x*hy + normal.x*cosTheta,
+                        tangentX.y*hx + tangentY.y*hy + normal.y*cosTheta,
+                        tangentX.z*hx + tangentY.z*hy + normal.z*cosTheta
+                    };
+
+                    // Reflect view (normal) direction around half vector
+                    float normalDotHalf = cosTheta;
+                    Vector3 light = { 2.0f*normalDotHalf*half.x - normal.x, 2.0f*normalDotHalf*half.y - normal.y, 2.0f*normalDotHalf*half.z - normal.z };
+                    float normalDotLight = normal.x*light.x + normal.y*light.y + normal.z*light.z;
+
+                    if (normalDotLight > 0.0f)
+                    {
+                        // Source mip level from sample solid angle, pdf = D(h)/4 when view equals normal
+                        float denom = normalDotHalf*normalDotHalf*(alphaSqr - 1.0f) + 1.0f;
+                        float pdf = (alphaSqr/(PI*denom*denom))/4.0f;
+                        float sampleSolidAngle = 1.0f/(sampleCount*pdf + 0.0001f);
+                        int mip = (int)(0.5f*log2f(sampleSolidAngle/sourceTexelSolidAngle) + 1.0f);
+                        mip = MIN(MAX(mip, 0), sourceLevels - 1);
+
+                        Vector4 color = SampleCubemapNormalized(sourceMips[mip], sourceSize >> mip, light);
+
+                        result.x += color.x*normalDotLight;
+                        result.y += color.y*normalDotLight;
+                        result.z += color.z*normalDotLight;
+                        result.w += color.w*normalDotLight;
+                        totalWeight += normalDotLight;
+                    }
+                }
+            }
+
+            faces[((size_t)face*levelSize + y)*levelSize + x] = (Vector4){ result.x/totalWeight, result.y/totalWeight, result.z/totalWeight, result.w/totalWeight };
+        }
+    }
 }
 
-// Get color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
+// Get normalized direction for a cubemap face texel center, faces order: +X, -X, +Y, -Y, +Z, -Z
+static Vector3 GetCubemapTexelDirection(int face, int x, int y, int size)
 {
-    Color result;
+    float u = 2.0f*(x + 0.5f)/size - 1.0f;
+    float v = 2.0f*(y + 0.5f)/size - 1.0f;
+    Vector3 direction = { 0 };
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    switch (face)
+    {
+        case 0: direction = (Vector3){ 1.0f, -v, -u }; break;
+        case 1: direction = (Vector3){ -1.0f, -v, u }; break;
+        case 2: direction = (Vector3){ u, 1.0f, v }; break;
+        case 3: direction = (Vector3){ u, -1.0f, -v }; break;
+        case 4: direction = (Vector3){ u, -v, 1.0f }; break;
+        case 5: direction = (Vector3){ -u, -v, -1.0f }; break;
+        default: break;
+    }
 
-    return result;
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
+
+    return (Vector3){ direction.x/length, direction.y/length, direction.z/length };
 }
 
-// Get HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Sample cubemap faces data in a direction, bilinear filtering (clamped to face edges)
+static Vector4 SampleCubemapNormalized(const Vector4 *faces, int size, Vector3 direction)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
-
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
-
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
-
-    hsv.z = max;            // Value
-    delta = max - min;
+    float absX = fabsf(direction.x);
+    float absY = fabsf(direction.y);
+    float absZ = fabsf(direction.z);
+    int face = 0;
+    float u = 0.0f, v = 0.0f, major = 1.0f;
 
-    if (delta < 0.00001f)
+    if ((absX >= absY) && (absX >= absZ))
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
+        major = absX;
+        if (direction.x > 0.0f) { face = 0; u = -direction.z; v = -direction.y; }
+        else { face = 1; u = direction.z; v = -direction.y; }
     }
-
-    if (max > 0.0f)
+    else if (absY >= absZ)
     {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
+        major = absY;
+        if (direction.y > 0.0f) { face = 2; u = direction.x; v = direction.z; }
+        else { face = 3; u = direction.x; v = -direction.z; }
     }
     else
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
+        major = absZ;
+        if (direction.z > 0.0f) { face = 4; u = direction.x; v = -direction.y; }
+        else { face = 5; u = -direction.x; v = -direction.y; }
     }
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
-    {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
-    }
+    // Face coordinates to texels
+    float fx = (u/major + 1.0f)*0.5f*size - 0.5f;
+    float fy = (v/major + 1.0f)*0.5f*size - 0.5f;
+    fx = fminf(fmaxf(fx, 0.0f), (float)(size - 1));
+    fy = fminf(fmaxf(fy, 0.0f), (float)(size - 1));
+
+    int x0 = (int)fx;
+    int y0 = (int)fy;
+    int x1 = MIN(x0 + 1, size - 1);
+    int y1 = MIN(y0 + 1, size - 1);
+    float tx = fx - x0;
+    float ty = fy - y0;
+
+    const Vector4 *data = faces + (size_t)face*size*size;
+    Vector4 c00 = data[y0*size + x0];
+    Vector4 c10 = data[y0*size + x1];
+    Vector4 c01 = data[y1*size + x0];
+    Vector4 c11 = data[y1*size + x1];
+
+    return (Vector4){
+        (c00.x*(1 - tx) + c10.x*tx)*(1 - ty) + (c01.x*(1 - tx) + c11.x*tx)*ty,
+        (c00.y*(1 - tx) + c10.y*tx)*(1 - ty) + (c01.y*(1 - tx) + c11.y*tx)*ty,
+        (c00.z*(1 - tx) + c10.z*tx)*(1 - ty) + (c01.z*(1 - tx) + c11.z*tx)*ty,
+        (c00.w*(1 - tx) + c10.w*tx)*(1 - ty) + (c01.w*(1 - tx) + c11.w*tx)*ty
+    };
+}
 
-    hsv.x *= 60.0f;     // Convert to degrees
+// Get spherical harmonics basis (3 bands, 9 coefficients) evaluated in a direction
+static void GetSphericalHarmonicsBasis(Vector3 direction, float *basis)
+{
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f*direction.y;
+    basis[2] = 0.488603f*direction.z;
+    basis[3] = 0.488603f*direction.x;
+    basis[4] = 1.092548f*direction.x*direction.y;
+    basis[5] = 1.092548f*direction.y*direction.z;
+    basis[6] = 0.315392f*(3.0f*direction.z*direction.z - 1.0f);
+    basis[7] = 1.092548f*direction.x*direction.z;
+    basis[8] = 0.546274f*(direction.x*direction.x - direction.y*direction.y);
+}
+#endif
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+#if defined(SUPPORT_IMAGE_THREADS)
+// Process image items range, thread entry point
+static void *ProcessImageBatch(void *batch)
+{
+    ImageProcessBatch *processBatch = (ImageProcessBatch *)batch;
 
-    return hsv;
+    processBatch->process(processBatch->data, processBatch->start, processBatch->end);
+
+    return NULL;
 }
 
-// Get a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
+// Decode textures batch pending files, until no file is pending or batch is cancelled
+static void *DecodeTextureBatchImages(void *data)
 {
-    Color color = { 0, 0, 0, 255 };
+    rTextureBatchData *batchData = (rTextureBatchData *)data;
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+    while (true)
+    {
+        int index = -1;
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+        pthread_mutex_lock(&batchData->mutex);
+        if (!batchData->cancel && (batchData->nextFile < batchData->count)) index = batchData->nextFile++;
+        pthread_mutex_unlock(&batchData->mutex);
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+        if (index == -1) break;
 
-    return color;
-}
+        Image image = LoadImage(batchData->fileNames[index]);
 
-// Get color multiplied with another color
-Color ColorTint(Color color, Color tint)
-{
-    Color result = color;
+        pthread_mutex_lock(&batchData->mutex);
+        batchData->images[index] = image;
+        batchData->states[index] = TEXTURE_BATCH_FILE_DECODED;
+        batchData->decoded++;
+        pthread_mutex_unlock(&batchData->mutex);
+    }
 
-    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+    return NULL;
+}
+#endif
 
-    result.r = r;
-    result.g = g;
-    result.b = b;
-    result.a = a;
+// Rotate pixel data 90 degrees (clockwise or counter-clockwise) into a new buffer
+// NOTE: Pixels are moved in square tiles, so both source reads and destination writes stay in cache,
+// every source tiles row is written to its own destination columns, so they can be split between threads
+static void RotatePixelData(const void *srcData, void *dstData, int width, int height, int bytesPerPixel, bool clockwise)
+{
+    ImageRotation rotation = { (const unsigned char *)srcData, (unsigned char *)dstData, width, height,
+        height, width, bytesPerPixel, clockwise, 0.0f, 0.0f };
 
-    return result;
+    ProcessImageItems(RotateImageTileRows, &rotation, (height + ROTATE_TILE_SIZE - 1)/ROTATE_TILE_SIZE, width*ROTATE_TILE_SIZE);
 }
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-Color ColorBrightness(Color color, float factor)
+// Rotate source tile rows range 90 degrees
+static void RotateImageTileRows(void *data, int start, int end)
 {
-    Color result = color;
+    ImageRotation *rotation = (ImageRotation *)data;
+    const unsigned char *src = rotation->src;
+    unsigned char *dst = rotation->dst;
+    int width = rotation->srcWidth;
+    int height = rotation->srcHeight;
+    int bytesPerPixel = rotation->bytesPerPixel;
+    bool clockwise = rotation->clockwise;
+
+    for (int tileY = start*ROTATE_TILE_SIZE; tileY < MIN(end*ROTATE_TILE_SIZE, height); tileY += ROTATE_TILE_SIZE)
+    {
+        int tileEndY = MIN(tileY + ROTATE_TILE_SIZE, height);
 
-    if (factor > 1.0f) factor = 1.0f;
-    else if (factor < -1.0f) factor = -1.0f;
+        for (int tileX = 0; tileX < width; tileX += ROTATE_TILE_SIZE)
+        {
+            int tileEndX = MIN(tileX + ROTATE_TILE_SIZE, width);
 
-    float red = (float)color.r;
-    float green = (float)color.g;
-    float blue = (float)color.b;
+            for (int x = tileX; x < tileEndX; x++)
+            {
+                // Destination row for source column x, destination column for source row y
+                // Clockwise: dst(height - 1 - y, x), Counter-clockwise: dst(y, width - 1 - x)
+                size_t dstRow = clockwise? (size_t)x*height : (size_t)(width - 1 - x)*height;
 
-    if (factor < 0.0f)
-    {
-        factor = 1.0f + factor;
-        red *= factor;
-        green *= factor;
-        blue *= factor;
-    }
-    else
-    {
-        red = (255 - red)*factor + red;
-        green = (255 - green)*factor + green;
-        blue = (255 - blue)*factor + blue;
+                for (int y = tileY; y < tileEndY; y++)
+                {
+                    size_t dstIndex = dstRow + (clockwise? (height - 1 - y) : y);
+                    const unsigned char *srcPixel = src + ((size_t)y*width + x)*bytesPerPixel;
+
+                    switch (bytesPerPixel)
+                    {
+                        case 1: dst[dstIndex] = *srcPixel; break;
+                        case 2: memcpy(dst + dstIndex*2, srcPixel, 2); break;
+                        case 3: memcpy(dst + dstIndex*3, srcPixel, 3); break;
+                        case 4: memcpy(dst + dstIndex*4, srcPixel, 4); break;
+                        default: memcpy(dst + dstIndex*bytesPerPixel, srcPixel, bytesPerPixel); break;
+                    }
+                }
+            }
+        }
     }
+}
 
-    result.r = (unsigned char)red;
-    result.g = (unsigned char)green;
-    result.b = (unsigned char)blue;
+// Rotate destination rows range by any angle, sampling source pixels with bilinear filtering
+// NOTE: Destination pixels out of the source image are not written
+static void RotateImageRows(void *data, int start, int end)
+{
+    ImageRotation *rotation = (ImageRotation *)data;
+    const unsigned char *srcData = rotation->src;
+    int srcWidth = rotation->srcWidth;
+    int srcHeight = rotation->srcHeight;
+    int width = rotation->dstWidth;
+    int height = rotation->dstHeight;
+    int bytesPerPixel = rotation->bytesPerPixel;
+    float sinRadius = rotation->sinRadius;
+    float cosRadius = rotation->cosRadius;
+
+    for (int y = start; y < end; y++)
+    {
+        // Source coordinates are linear along the row, get row start and
+        // step incrementally (DDA) instead of evaluating rotation per pixel
+        float oldX = (-width/2.0f*cosRadius + (y - height/2.0f)*sinRadius) + srcWidth/2.0f;
+        float oldY = ((y - height/2.0f)*cosRadius + width/2.0f*sinRadius) + srcHeight/2.0f;
+        unsigned char *dstPixel = rotation->dst + (size_t)y*width*bytesPerPixel;
 
-    return result;
+        for (int x = 0; x < width; x++, oldX += cosRadius, oldY -= sinRadius, dstPixel += bytesPerPixel)
+        {
+            if ((oldX >= 0) && (oldX < srcWidth) && (oldY >= 0) && (oldY < srcHeight))
+            {
+                int x1 = (int)oldX;
+                int y1 = (int)oldY;
+                int x2 = MIN(x1 + 1, srcWidth - 1);
+                int y2 = MIN(y1 + 1, srcHeight - 1);
+
+                float px = oldX - x1;
+                float py = oldY - y1;
+
+                // Bilinear weights, computed once for all pixel components
+                float w1 = (1 - px)*(1 - py);
+                float w2 = px*(1 - py);
+                float w3 = (1 - px)*py;
+                float w4 = px*py;
+
+                const unsigned char *p1 = srcData + ((size_t)y1*srcWidth + x1)*bytesPerPixel;
+                const unsigned char *p2 = srcData + ((size_t)y1*srcWidth + x2)*bytesPerPixel;
+                const unsigned char *p3 = srcData + ((size_t)y2*srcWidth + x1)*bytesPerPixel;
+                const unsigned char *p4 = srcData + ((size_t)y2*srcWidth + x2)*bytesPerPixel;
+
+                for (int i = 0; i < bytesPerPixel; i++) dstPixel[i] = (unsigned char)(p1[i]*w1 + p2[i]*w2 + p3[i]*w3 + p4[i]*w4);
+            }
+        }
+    }
 }
 
-// Get color with contrast correction
-// NOTE: Contrast values between -1.0f and 1.0f
-Color ColorContrast(Color color, float contrast)
+// Load skyline rectangles packer for a packing area
+static SkylinePacker *LoadSkylinePacker(int width, int height)
 {
-    Color result = color;
+    SkylinePacker *packer = (SkylinePacker *)RL_CALLOC(1, sizeof(SkylinePacker));
 
-    if (contrast < -1.0f) contrast = -1.0f;
-    else if (contrast > 1.0f) contrast = 1.0f;
-
-    contrast = (1.0f + contrast);
-    contrast *= contrast;
+    packer->width = width;
+    packer->height = height;
 
-    float pR = (float)color.r/255.0f;
-    pR -= 0.5f;
-    pR *= contrast;
-    pR += 0.5f;
-    pR *= 255;
-    if (pR < 0) pR = 0;
-    else if (pR > 255) pR = 255;
+    // NOTE: Every node is at least 1 pixel wide, so there can not be more nodes than width
+    packer->nodes = (SkylineNode *)RL_CALLOC(width + 1, sizeof(SkylineNode));
 
-    float pG = (float)color.g/255.0f;
-    pG -= 0.5f;
-    pG *= contrast;
-    pG += 0.5f;
-    pG *= 255;
-    if (pG < 0) pG = 0;
-    else if (pG > 255) pG = 255;
+    ResetSkylinePacker(packer);
 
-    float pB = (float)color.b/255.0f;
-    pB -= 0.5f;
-    pB *= contrast;
-    pB += 0.5f;
-    pB *= 255;
-    if (pB < 0) pB = 0;
-    else if (pB > 255) pB = 255;
+    return packer;
+}
 
-    result.r = (unsigned char)pR;
-    result.g = (unsigned char)pG;
-    result.b = (unsigned char)pB;
+// Unload skyline rectangles packer
+static void UnloadSkylinePacker(SkylinePacker *packer)
+{
+    if (packer != NULL)
+    {
+        RL_FREE(packer->nodes);
+        RL_FREE(packer);
+    }
+}
 
-    return result;
+// Reset skyline packer, packing area becomes empty
+static void ResetSkylinePacker(SkylinePacker *packer)
+{
+    packer->nodeCount = 1;
+    packer->nodes[0] = (SkylineNode){ 0, 0, packer->width };
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
+// Pack rectangle into skyline, returns false if rectangle does not fit
+// NOTE: Bottom-left heuristic, rectangle placed at the lowest position available, less wasted width on ties
+static bool PackSkylineRec(SkylinePacker *packer, int width, int height, int *x, int *y)
 {
-    Color result = color;
+    int bestIndex = -1;
+    int bestTop = packer->height + 1;
+    int bestWaste = 0;
+    int bestX = 0;
+    int bestY = 0;
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    for (int i = 0; i < packer->nodeCount; i++)
+    {
+        int nodeX = packer->nodes[i].x;
+        if ((nodeX + width) > packer->width) break;
 
-    result.a = (unsigned char)(255.0f*alpha);
+        // Get the rectangle lowest position at this node: highest node below rectangle width
+        int posY = 0;
+        int waste = 0;
+        int remaining = width;
 
-    return result;
-}
+        for (int k = i; (remaining > 0) && (k < packer->nodeCount); k++)
+        {
+            if (packer->nodes[k].y > posY) posY = packer->nodes[k].y;
+            remaining -= packer->nodes[k].width;
+        }
 
-// Get src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
-{
-    Color out = WHITE;
+        if ((posY + height) > packer->height) continue;
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+        // Measure wasted area below rectangle
+        remaining = width;
+        for (int k = i; (remaining > 0) && (k < packer->nodeCount); k++)
+        {
+            int spanWidth = (packer->nodes[k].width < remaining)? packer->nodes[k].width : remaining;
+            waste += (posY - packer->nodes[k].y)*spanWidth;
+            remaining -= spanWidth;
+        }
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+        if (((posY + height) < bestTop) || (((posY + height) == bestTop) && (waste < bestWaste)))
+        {
+            bestIndex = i;
+            bestTop = posY + height;
+            bestWaste = waste;
+            bestX = nodeX;
+            bestY = posY;
+        }
+    }
+
+    if (bestIndex == -1) return false;
+
+    // Insert new node on top of packed rectangle
+    SkylineNode *nodes = packer->nodes;
+    memmove(&nodes[bestIndex + 1], &nodes[bestIndex], (packer->nodeCount - bestIndex)*sizeof(SkylineNode));
+    nodes[bestIndex] = (SkylineNode){ bestX, bestY + height, width };
+    packer->nodeCount++;
+
+    // Shrink or remove the nodes covered by the new node
+    for (int i = bestIndex + 1; i < packer->nodeCount; i++)
     {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        int coverEnd = nodes[bestIndex].x + nodes[bestIndex].width;
 
-        if (out.a > 0)
+        if (nodes[i].x >= coverEnd) break;
+
+        int shrink = coverEnd - nodes[i].x;
+
+        if (shrink < nodes[i].width)
         {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            nodes[i].x += shrink;
+            nodes[i].width -= shrink;
+            break;
         }
+
+        memmove(&nodes[i], &nodes[i + 1], (packer->nodeCount - i - 1)*sizeof(SkylineNode));
+        packer->nodeCount--;
+        i--;
     }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+
+    // Merge contiguous nodes at the same height
+    for (int i = 0; i < (packer->nodeCount - 1); i++)
     {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
+        if (nodes[i].y == nodes[i + 1].y)
+        {
+            nodes[i].width += nodes[i + 1].width;
+            memmove(&nodes[i + 1], &nodes[i + 2], (packer->nodeCount - i - 2)*sizeof(SkylineNode));
+            packer->nodeCount--;
+            i--;
+        }
+    }
 
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+    *x = bestX;
+    *y = bestY;
 
-        if (fout.w > 0.0f)
-        {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+    return true;
+}
+
+// Pack rectangle into texture atlas, returns false if rectangle does not fit
+// NOTE: Free rectangles released below the skyline are tried first (best area fit),
+// used free rectangle is split in two (guillotine), along the shorter leftover side
+static bool PackTextureAtlasRec(rAtlasData *data, int width, int height, int *x, int *y)
+{
+    int bestIndex = -1;
+    int bestArea = 0;
+
+    for (int i = 0; i < data->freeCount; i++)
+    {
+        int freeWidth = (int)data->freeRecs[i].width;
+        int freeHeight = (int)data->freeRecs[i].height;
+
+        if ((width <= freeWidth) && (height <= freeHeight) && ((bestIndex == -1) || ((freeWidth*freeHeight) < bestArea)))
+        {
+            bestIndex = i;
+            bestArea = freeWidth*freeHeight;
         }
+    }
 
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    if (bestIndex == -1) return PackSkylineRec(data->packer, width, height, x, y);
+
+    Rectangle free = data->freeRecs[bestIndex];
+    *x = (int)free.x;
+    *y = (int)free.y;
+
+    // Remove used free rectangle, leftover parts added back
+    data->freeRecs[bestIndex] = data->freeRecs[data->freeCount - 1];
+    data->freeCount--;
+
+    int leftoverWidth = (int)free.width - width;
+    int leftoverHeight = (int)free.height - height;
+    Rectangle right = { free.x + width, free.y, (float)leftoverWidth, (leftoverWidth < leftoverHeight)? (float)height : free.height };
+    Rectangle bottom = { free.x, free.y + height, (leftoverWidth < leftoverHeight)? free.width : (float)width, (float)leftoverHeight };
+
+    if ((data->freeCount + 2) > data->freeCapacity)
+    {
+        data->freeCapacity *= 2;
+        data->freeRecs = (Rectangle *)RL_REALLOC(data->freeRecs, data->freeCapacity*sizeof(Rectangle));
     }
-#endif
 
-    return out;
+    if ((right.width > 0) && (right.height > 0)) data->freeRecs[data->freeCount++] = right;
+    if ((bottom.width > 0) && (bottom.height > 0)) data->freeRecs[data->freeCount++] = bottom;
+
+    return true;
 }
 
-// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
-Color ColorLerp(Color color1, Color color2, float factor)
+// Release texture atlas region space, region pixels are cleared and space is added to free rectangles
+static void ReleaseTextureAtlasRec(rAtlasData *data, int id)
 {
-    Color color = { 0 };
+    Rectangle rec = data->recs[id];
+    int bytesPerPixel = GetPixelDataSize(1, 1, data->image.format);
 
-    if (factor < 0.0f) factor = 0.0f;
-    else if (factor > 1.0f) factor = 1.0f;
+    for (int row = 0; row < (int)rec.height; row++)
+    {
+        memset((unsigned char *)data->image.data + ((size_t)((int)rec.y + row)*data->image.width + (int)rec.x)*bytesPerPixel, 0, (int)rec.width*bytesPerPixel);
+    }
 
-    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
-    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
-    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
-    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+    if ((data->freeCount + 1) > data->freeCapacity)
+    {
+        data->freeCapacity = (data->freeCapacity == 0)? 64 : data->freeCapacity*2;
+        data->freeRecs = (Rectangle *)RL_REALLOC(data->freeRecs, data->freeCapacity*sizeof(Rectangle));
+    }
 
-    return color;
+    data->freeRecs[data->freeCount] = (Rectangle){ rec.x, rec.y, rec.width + TEXTURE_ATLAS_PADDING, rec.height + TEXTURE_ATLAS_PADDING };
+    data->freeCount++;
+    data->usedArea -= ((int)rec.width + TEXTURE_ATLAS_PADDING)*((int)rec.height + TEXTURE_ATLAS_PADDING);
+    data->recs[id] = (Rectangle){ 0 };
+
+    // Atlas is empty, restart packing from scratch
+    if (data->usedArea == 0)
+    {
+        ResetSkylinePacker(data->packer);
+        data->freeCount = 0;
+    }
 }
 
-// Get a Color struct from hexadecimal value
-Color GetColor(unsigned int hexValue)
+// Upload texture atlas region pixels to GPU, including padding border around it
+// NOTE: Padding around live regions is always clear in GPU, released regions are not cleared in GPU
+static void UploadTextureAtlasRec(TextureAtlas atlas, Rectangle rec)
 {
-    Color color;
+    rAtlasData *data = atlas.data;
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
-    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
-    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
-    color.a = (unsigned char)hexValue & 0xFF;
+    int x = (int)rec.x - TEXTURE_ATLAS_PADDING;
+    int y = (int)rec.y - TEXTURE_ATLAS_PADDING;
+    int width = (int)rec.width + 2*TEXTURE_ATLAS_PADDING;
+    int height = (int)rec.height + 2*TEXTURE_ATLAS_PADDING;
 
-    return color;
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > data->image.width) width = data->image.width - x;
+    if ((y + height) > data->image.height) height = data->image.height - y;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, data->image.format);
+    unsigned char *pixels = (unsigned char *)RL_MALLOC((size_t)width*height*bytesPerPixel);
+
+    for (int row = 0; row < height; row++)
+    {
+        memcpy(pixels + (size_t)row*width*bytesPerPixel, (unsigned char *)data->image.data + ((size_t)(y + row)*data->image.width + x)*bytesPerPixel, width*bytesPerPixel);
+    }
+
+    rlUpdateTexture(atlas.texture.id, x, y, width, height, data->image.format, pixels);
+
+    RL_FREE(pixels);
 }
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
+// Evict least recently used region from texture atlas, region space is released
+// NOTE: Evicted regions keep their id, returns false if there was nothing to evict
+static bool EvictTextureAtlasRegion(TextureAtlas atlas)
 {
-    Color color = { 0 };
+    rAtlasData *data = atlas.data;
+    int lruIndex = -1;
 
-    switch (format)
+    for (int i = 0; i < data->regionCount; i++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
+        if ((data->recs[i].width > 0) && (data->lastUse[i] > 0) &&
+            ((lruIndex == -1) || (data->lastUse[i] < data->lastUse[lruIndex]))) lruIndex = i;
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+    if (lruIndex == -1) return false;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+    ReleaseTextureAtlasRec(data, lruIndex);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+    return true;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+// Compress RGBA 32bit pixel data into a block compressed format (DXT/ETC)
+// NOTE: Width and height must be multiple of 4 (block size)
+static void CompressPixelBlocks(const unsigned char *pixels, int width, int height, int format, unsigned char *output)
+{
+    unsigned char block[64] = { 0 };    // 4x4 RGBA pixels
+    unsigned char *dst = output;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+    for (int by = 0; by < height; by += 4)
+    {
+        for (int bx = 0; bx < width; bx += 4)
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+            for (int y = 0; y < 4; y++) memcpy(block + y*16, pixels + ((size_t)(by + y)*width + bx)*4, 16);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
+            switch (format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: EncodeBlockBC1(block, dst, false); dst += 8; break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: EncodeBlockBC1(block, dst, true); dst += 8; break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    // Explicit 4bit alpha, followed by color block
+                    for (int i = 0; i < 8; i++)
+                    {
+                        int a0 = (block[(i*2)*4 + 3]*15 + 127)/255;
+                        int a1 = (block[(i*2 + 1)*4 + 3]*15 + 127)/255;
+                        dst[i] = (unsigned char)(a0 | (a1 << 4));
+                    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
+                    EncodeBlockBC1(block, dst + 8, false);
+                    dst += 16;
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    EncodeBlockAlphaBC3(block, dst);
+                    EncodeBlockBC1(block, dst + 8, false);
+                    dst += 16;
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: EncodeBlockETC1(block, dst); dst += 8; break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    EncodeBlockAlphaEAC(block, dst);
+                    EncodeBlockETC1(block, dst + 8);
+                    dst += 16;
+                } break;
+                default: break;
+            }
+        }
+    }
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+// Encode a 4x4 RGBA block into a BC1 (DXT1) color block
+// NOTE: If alphaMode is enabled, transparent pixels (alpha < 128) use the 3-color block mode
+static void EncodeBlockBC1(const unsigned char *block, unsigned char *output, bool alphaMode)
+{
+    bool transparent[16] = { 0 };
+    bool hasTransparent = false;
+    int opaqueCount = 0;
+    float mean[3] = { 0 };
 
-        } break;
-        default: break;
+    for (int i = 0; i < 16; i++)
+    {
+        if (alphaMode && (block[i*4 + 3] < 128)) { transparent[i] = true; hasTransparent = true; continue; }
+
+        mean[0] += block[i*4];
+        mean[1] += block[i*4 + 1];
+        mean[2] += block[i*4 + 2];
+        opaqueCount++;
     }
 
-    return color;
-}
+    if (opaqueCount == 0)
+    {
+        // Fully transparent block: 3-color mode (color0 <= color1) with all indices transparent
+        memset(output, 0, 4);
+        memset(output + 4, 0xff, 4);
+        return;
+    }
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
-{
-    switch (format)
+    for (int c = 0; c < 3; c++) mean[c] /= (float)opaqueCount;
+
+    // Get principal axis from colors covariance (power iteration)
+    float cov[6] = { 0 };
+    for (int i = 0; i < 16; i++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        if (transparent[i]) continue;
 
-            ((unsigned char *)dstPtr)[0] = gray;
+        float r = block[i*4] - mean[0];
+        float g = block[i*4 + 1] - mean[1];
+        float b = block[i*4 + 2] - mean[2];
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+        cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+    }
 
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (int iter = 0; iter < 4; iter++)
+    {
+        float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+        float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+        float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+        float length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+        if (length < 0.0001f) break;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+        axis[0] = x/length; axis[1] = y/length; axis[2] = z/length;
+    }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    // Get endpoints from colors with extreme projections over the axis
+    float minDot = 1e30f;
+    float maxDot = -1e30f;
+    int minIndex = 0;
+    int maxIndex = 0;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparent[i]) continue;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+        float dot = block[i*4]*axis[0] + block[i*4 + 1]*axis[1] + block[i*4 + 2]*axis[2];
+        if (dot < minDot) { minDot = dot; minIndex = i; }
+        if (dot > maxDot) { maxDot = dot; maxIndex = i; }
+    }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    float endpoints[2][3] = {
+        { block[maxIndex*4], block[maxIndex*4 + 1], block[maxIndex*4 + 2] },
+        { block[minIndex*4], block[minIndex*4 + 1], block[minIndex*4 + 2] }
+    };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+    unsigned char indices[16] = { 0 };
+
+    for (int iter = 0; iter <= BLOCK_COMPRESSION_REFINE_ITERATIONS; iter++)
+    {
+        color0 = (unsigned short)((((int)(endpoints[0][0]*31.0f/255.0f + 0.5f)) << 11) | (((int)(endpoints[0][1]*63.0f/255.0f + 0.5f)) << 5) | ((int)(endpoints[0][2]*31.0f/255.0f + 0.5f)));
+        color1 = (unsigned short)((((int)(endpoints[1][0]*31.0f/255.0f + 0.5f)) << 11) | (((int)(endpoints[1][1]*63.0f/255.0f + 0.5f)) << 5) | ((int)(endpoints[1][2]*31.0f/255.0f + 0.5f)));
+
+        // Set endpoints order to select block mode: 4-color (color0 > color1) or 3-color (color0 <= color1)
+        if ((hasTransparent && (color0 > color1)) || (!hasTransparent && (color0 < color1)))
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            unsigned short temp = color0;
+            color0 = color1;
+            color1 = temp;
+        }
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+        // Get block palette from quantized endpoints
+        int palette[4][3] = { 0 };
+        palette[0][0] = ((color0 >> 11) << 3) | (color0 >> 13);
+        palette[0][1] = (((color0 >> 5) & 0x3f) << 2) | ((color0 >> 9) & 0x03);
+        palette[0][2] = ((color0 & 0x1f) << 3) | ((color0 >> 2) & 0x07);
+        palette[1][0] = ((color1 >> 11) << 3) | (color1 >> 13);
+        palette[1][1] = (((color1 >> 5) & 0x3f) << 2) | ((color1 >> 9) & 0x03);
+        palette[1][2] = ((color1 & 0x1f) << 3) | ((color1 >> 2) & 0x07);
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+        int paletteCount = (color0 > color1)? 4 : 3;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        for (int c = 0; c < 3; c++)
         {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+            if (paletteCount == 4)
+            {
+                palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+                palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+            }
+            else palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        // Select nearest palette entry for every pixel
+        for (int i = 0; i < 16; i++)
         {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+            if (transparent[i]) { indices[i] = 3; continue; }
 
-        } break;
-        default: break;
-    }
-}
+            int bestError = INT_MAX;
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
-{
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+            for (int p = 0; p < paletteCount; p++)
+            {
+                int dr = block[i*4] - palette[p][0];
+                int dg = block[i*4 + 1] - palette[p][1];
+                int db = block[i*4 + 2] - palette[p][2];
+                int error = dr*dr + dg*dg + db*db;
 
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
-    }
+                if (error < bestError) { bestError = error; indices[i] = (unsigned char)p; }
+            }
+        }
 
-    double bytesPerPixel = (double)bpp/8.0;
-    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+        if ((iter == BLOCK_COMPRESSION_REFINE_ITERATIONS) || (paletteCount != 4)) break;
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        // Refine endpoints with least squares fitting for the selected indices
+        const float weights[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[3] = { 0 };
+        float bx[3] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            float a = weights[indices[i]];
+            float b = 1.0f - a;
+
+            aa += a*a; ab += a*b; bb += b*b;
+
+            for (int c = 0; c < 3; c++)
+            {
+                ax[c] += a*block[i*4 + c];
+                bx[c] += b*block[i*4 + c];
+            }
+        }
+
+        float det = aa*bb - ab*ab;
+        if (fabsf(det) < 0.0001f) break;
+
+        for (int c = 0; c < 3; c++)
+        {
+            endpoints[0][c] = fminf(fmaxf((ax[c]*bb - bx[c]*ab)/det, 0.0f), 255.0f);
+            endpoints[1][c] = fminf(fmaxf((bx[c]*aa - ax[c]*ab)/det, 0.0f), 255.0f);
+        }
     }
 
-    return dataSize;
+    unsigned int indexBits = 0;
+    for (int i = 0; i < 16; i++) indexBits |= (unsigned int)indices[i] << (i*2);
+
+    output[0] = (unsigned char)(color0 & 0xff);
+    output[1] = (unsigned char)(color0 >> 8);
+    output[2] = (unsigned char)(color1 & 0xff);
+    output[3] = (unsigned char)(color1 >> 8);
+    output[4] = (unsigned char)(indexBits & 0xff);
+    output[5] = (unsigned char)((indexBits >> 8) & 0xff);
+    output[6] = (unsigned char)((indexBits >> 16) & 0xff);
+    output[7] = (unsigned char)(indexBits >> 24);
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Encode alpha channel of a 4x4 RGBA block into a BC3 (DXT5) alpha block
+static void EncodeBlockAlphaBC3(const unsigned char *block, unsigned char *output)
 {
-    float result = 0.0f;
+    int alphaMin = 255;
+    int alphaMax = 0;
 
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int *)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i*4 + 3] < alphaMin) alphaMin = block[i*4 + 3];
+        if (block[i*4 + 3] > alphaMax) alphaMax = block[i*4 + 3];
+    }
 
-    result = *(float *)&r;
+    output[0] = (unsigned char)alphaMax;
+    output[1] = (unsigned char)alphaMin;
 
-    return result;
-}
+    unsigned long long indexBits = 0;
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
-{
-    unsigned short result = 0;
+    if (alphaMax > alphaMin)
+    {
+        // 8-alpha block mode (alpha0 > alpha1)
+        int palette[8] = { alphaMax, alphaMin };
+        for (int p = 2; p < 8; p++) palette[p] = ((8 - p)*alphaMax + (p - 1)*alphaMin)/7;
 
-    const unsigned int b = (*(unsigned int *) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+        for (int i = 0; i < 16; i++)
+        {
+            int bestIndex = 0;
+            int bestError = 256;
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+            for (int p = 0; p < 8; p++)
+            {
+                int error = abs(block[i*4 + 3] - palette[p]);
+                if (error < bestError) { bestError = error; bestIndex = p; }
+            }
 
-    return result;
+            indexBits |= (unsigned long long)bestIndex << (i*3);
+        }
+    }
+
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)((indexBits >> (i*8)) & 0xff);
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Encode a 4x4 RGBA block into an ETC1 block (also valid as ETC2 RGB block)
+// NOTE: Individual and differential modes tested for both block flips, alpha is ignored
+static void EncodeBlockETC1(const unsigned char *block, unsigned char *output)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    static const int modifierTable[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    int bestError = INT_MAX;
+    unsigned long long bestBits = 0;
+
+    for (int flip = 0; flip < 2; flip++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        // Get subblocks average colors
+        // NOTE: Pixels order in ETC is column-major, subblocks are 2x4 (flip = 0) or 4x2 (flip = 1)
+        float average[2][3] = { 0 };
+        int subblock[16] = { 0 };
+
+        for (int y = 0; y < 4; y++)
         {
-            switch (image.format)
+            for (int x = 0; x < 4; x++)
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                int s = (flip == 0)? (x >= 2) : (y >= 2);
+                subblock[y*4 + x] = s;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                for (int c = 0; c < 3; c++) average[s][c] += block[(y*4 + x)*4 + c]/8.0f;
+            }
+        }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        for (int diff = 0; diff < 2; diff++)
+        {
+            int base[2][3] = { 0 };         // Quantized base colors
+            int baseColor[2][3] = { 0 };    // Expanded base colors
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+            if (diff == 1)
+            {
+                bool valid = true;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                for (int c = 0; c < 3; c++)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    base[0][c] = (int)(average[0][c]*31.0f/255.0f + 0.5f);
+                    base[1][c] = (int)(average[1][c]*31.0f/255.0f + 0.5f);
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+                    int delta = base[1][c] - base[0][c];
+                    if ((delta < -4) || (delta > 3)) valid = false;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                    baseColor[0][c] = (base[0][c] << 3) | (base[0][c] >> 2);
+                    baseColor[1][c] = (base[1][c] << 3) | (base[1][c] >> 2);
+                }
+
+                if (!valid) continue;
+            }
+            else
+            {
+                for (int c = 0; c < 3; c++)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    base[0][c] = (int)(average[0][c]*15.0f/255.0f + 0.5f);
+                    base[1][c] = (int)(average[1][c]*15.0f/255.0f + 0.5f);
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+                    baseColor[0][c] = (base[0][c] << 4) | base[0][c];
+                    baseColor[1][c] = (base[1][c] << 4) | base[1][c];
+                }
+            }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+            int totalError = 0;
+            int tables[2] = { 0 };
+            unsigned char indices[16] = { 0 };
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+            for (int s = 0; s < 2; s++)
+            {
+                int bestTableError = INT_MAX;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
+                for (int t = 0; t < 8; t++)
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                    const int modifiers[4] = { modifierTable[t][0], modifierTable[t][1], -modifierTable[t][0], -modifierTable[t][1] };
+                    int tableError = 0;
+                    unsigned char tableIndices[16] = { 0 };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                    for (int i = 0; (i < 16) && (tableError < bestTableError); i++)
+                    {
+                        if (subblock[i] != s) continue;
+
+                        int bestPixelError = INT_MAX;
+
+                        for (int m = 0; m < 4; m++)
+                        {
+                            int error = 0;
+
+                            for (int c = 0; c < 3; c++)
+                            {
+                                int value = baseColor[s][c] + modifiers[m];
+                                value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                                error += (value - block[i*4 + c])*(value - block[i*4 + c]);
+                            }
+
+                            if (error < bestPixelError) { bestPixelError = error; tableIndices[i] = (unsigned char)m; }
+                        }
+
+                        tableError += bestPixelError;
+                    }
+
+                    if (tableError < bestTableError)
+                    {
+                        bestTableError = tableError;
+                        tables[s] = t;
+                        for (int i = 0; i < 16; i++) if (subblock[i] == s) indices[i] = tableIndices[i];
+                    }
+                }
+
+                totalError += bestTableError;
+            }
+
+            if (totalError < bestError)
+            {
+                unsigned long long bits = 0;
+
+                if (diff == 1)
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+                    bits |= (unsigned long long)base[0][0] << 59;
+                    bits |= (unsigned long long)((base[1][0] - base[0][0]) & 0x7) << 56;
+                    bits |= (unsigned long long)base[0][1] << 51;
+                    bits |= (unsigned long long)((base[1][1] - base[0][1]) & 0x7) << 48;
+                    bits |= (unsigned long long)base[0][2] << 43;
+                    bits |= (unsigned long long)((base[1][2] - base[0][2]) & 0x7) << 40;
+                }
+                else
+                {
+                    bits |= (unsigned long long)base[0][0] << 60;
+                    bits |= (unsigned long long)base[1][0] << 56;
+                    bits |= (unsigned long long)base[0][1] << 52;
+                    bits |= (unsigned long long)base[1][1] << 48;
+                    bits |= (unsigned long long)base[0][2] << 44;
+                    bits |= (unsigned long long)base[1][2] << 40;
+                }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                bits |= (unsigned long long)tables[0] << 37;
+                bits |= (unsigned long long)tables[1] << 34;
+                bits |= (unsigned long long)diff << 33;
+                bits |= (unsigned long long)flip << 32;
+
+                for (int y = 0; y < 4; y++)
                 {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                    for (int x = 0; x < 4; x++)
+                    {
+                        int index = indices[y*4 + x];
+                        int bit = x*4 + y;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
+                        bits |= (unsigned long long)(index >> 1) << (bit + 16);
+                        bits |= (unsigned long long)(index & 1) << bit;
+                    }
+                }
+
+                bestError = totalError;
+                bestBits = bits;
+            }
+        }
+    }
+
+    for (int i = 0; i < 8; i++) output[i] = (unsigned char)((bestBits >> (56 - i*8)) & 0xff);
+}
+
+// Encode alpha channel of a 4x4 RGBA block into an EAC alpha block (ETC2 RGBA)
+static void EncodeBlockAlphaEAC(const unsigned char *block, unsigned char *output)
+{
+    static const int modifierTable[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    int alphaMin = 255;
+    int alphaMax = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i*4 + 3] < alphaMin) alphaMin = block[i*4 + 3];
+        if (block[i*4 + 3] > alphaMax) alphaMax = block[i*4 + 3];
+    }
+
+    // Default: uniform alpha, table 13 contains a zero modifier (index 4)
+    int bestBase = alphaMin;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    int bestError = INT_MAX;
+    unsigned char bestIndices[16] = { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+
+    if (alphaMax > alphaMin)
+    {
+        for (int t = 0; (t < 16) && (bestError > 0); t++)
+        {
+            int range = modifierTable[t][7] - modifierTable[t][3];
+            int multiplier = ((alphaMax - alphaMin) + range/2)/range;
+
+            // Try the closest multipliers, base value centers the table range over alpha range
+            for (int m = multiplier; m <= (multiplier + 1); m++)
+            {
+                if ((m < 1) || (m > 15)) continue;
+
+                int base = (alphaMin + alphaMax - m*(modifierTable[t][3] + modifierTable[t][7]) + 1)/2;
+                base = (base < 0)? 0 : ((base > 255)? 255 : base);
+
+                int error = 0;
+                unsigned char indices[16] = { 0 };
+
+                for (int i = 0; (i < 16) && (error < bestError); i++)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                    int bestPixelError = INT_MAX;
+
+                    for (int k = 0; k < 8; k++)
+                    {
+                        int value = base + m*modifierTable[t][k];
+                        value = (value < 0)? 0 : ((value > 255)? 255 : value);
+
+                        int pixelError = (value - block[i*4 + 3])*(value - block[i*4 + 3]);
+                        if (pixelError < bestPixelError) { bestPixelError = pixelError; indices[i] = (unsigned char)k; }
+                    }
+
+                    error += bestPixelError;
+                }
+
+                if (error < bestError)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                    bestError = error;
+                    bestBase = base;
+                    bestMultiplier = m;
+                    bestTable = t;
+                    memcpy(bestIndices, indices, 16);
+                }
+            }
+        }
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+    unsigned long long bits = 0;
+    bits |= (unsigned long long)bestBase << 56;
+    bits |= (unsigned long long)bestMultiplier << 52;
+    bits |= (unsigned long long)bestTable << 48;
+
+    // NOTE: Pixels order in EAC is column-major, first pixel on most significant bits
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++) bits |= (unsigned long long)bestIndices[y*4 + x] << (45 - (x*4 + y)*3);
+    }
+
+    for (int i = 0; i < 8; i++) output[i] = (unsigned char)((bits >> (56 - i*8)) & 0xff);
+}
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_COMPRESSION_API)
+// Compress image export data into a zlib stream (RFC 1950), used by PNG writer
+// NOTE: Level 0 writes uncompressed stored blocks, other levels use sdefl compressor
+static unsigned char *CompressImageExportData(unsigned char *data, int dataSize, int *compDataSize, int level)
+{
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
+
+    if (level == 0)
+    {
+        // Stored blocks: zlib header + blocks of 65535 bytes max (5 bytes header each) + adler32
+        int blockCount = (dataSize + 65534)/65535;
+        if (blockCount == 0) blockCount = 1;
+
+        compData = (unsigned char *)RL_MALLOC(2 + blockCount*5 + dataSize + 4);
+        unsigned char *output = compData;
+
+        *output++ = 0x78;       // Deflate, 32K window
+        *output++ = 0x01;       // No compression level hint
+
+        unsigned int s1 = 1;
+        unsigned int s2 = 0;
+
+        for (int i = 0; i < blockCount; i++)
+        {
+            int offset = i*65535;
+            int size = ((dataSize - offset) < 65535)? (dataSize - offset) : 65535;
+
+            *output++ = (i == (blockCount - 1))? 1 : 0;   // BFINAL bit, BTYPE = 00 (stored)
+            *output++ = (unsigned char)(size & 0xff);
+            *output++ = (unsigned char)(size >> 8);
+            *output++ = (unsigned char)(~size & 0xff);
+            *output++ = (unsigned char)((~size >> 8) & 0xff);
+
+            memcpy(output, data + offset, size);
+            output += size;
+
+            // Update adler32 checksum
+            // NOTE: Block size is small enough to avoid 32bit overflow before modulo
+            for (int k = 0; k < size; k += 5552)
+            {
+                int end = ((k + 5552) < size)? (k + 5552) : size;
+
+                for (int j = k; j < end; j++)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                    s1 += data[offset + j];
+                    s2 += s1;
+                }
 
-                    k += 4;
-                } break;
-                default: break;
+                s1 %= 65521;
+                s2 %= 65521;
             }
         }
+
+        unsigned int adler = (s2 << 16) | s1;
+        *output++ = (unsigned char)(adler >> 24);
+        *output++ = (unsigned char)((adler >> 16) & 0xff);
+        *output++ = (unsigned char)((adler >> 8) & 0xff);
+        *output++ = (unsigned char)(adler & 0xff);
+
+        *compDataSize = (int)(output - compData);
     }
+    else
+    {
+        struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB
+        compData = (unsigned char *)RL_MALLOC(sdefl_bound(dataSize));
 
-    return pixels;
+        // NOTE: PNG levels [1..9] are mapped to sdefl levels [1..5], higher sdefl levels
+        // are much slower for a small compression gain (default PNG level 8 -> sdefl level 4)
+        *compDataSize = zsdeflate(sdefl, compData, data, dataSize, (level + 1)/2);
+
+        RL_FREE(sdefl);
+    }
+
+    return compData;
 }
+#endif
 
 #endif      // SUPPORT_MODULE_RTEXTURES
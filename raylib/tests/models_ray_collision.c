@@ -0,0 +1,103 @@
+/*******************************************************************************************
+*
+*   raylib [models] test - Ray collision with transformed meshes
+*
+*   NOTE: Test runs headless (no window required), meshes are not uploaded to GPU,
+*   collisions are tested with and without mesh BVH, using scaled, rotated and mirrored transforms
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <math.h>           // Required for: fabsf()
+
+static int failCount = 0;
+
+// Generate quad mesh of provided size on XY plane, centered at origin, facing +Z
+// NOTE: Mesh is not uploaded to GPU
+static Mesh GenMeshQuadXY(float size)
+{
+    Mesh mesh = { 0 };
+    float h = size/2.0f;
+    float vertices[18] = { -h, -h, 0, h, -h, 0, h, h, 0, -h, -h, 0, h, h, 0, -h, h, 0 };
+
+    mesh.vertexCount = 6;
+    mesh.triangleCount = 2;
+    mesh.vertices = (float *)MemAlloc(18*sizeof(float));
+    for (int i = 0; i < 18; i++) mesh.vertices[i] = vertices[i];
+
+    return mesh;
+}
+
+// Check ray collision against expected distance and normal
+static void CheckRayCollision(const char *name, RayCollision collision, bool hit, float distance, Vector3 normal)
+{
+    if (collision.hit != hit)
+    {
+        printf("FAILED: %s (expected %s)\n", name, hit? "hit" : "no hit");
+        failCount++;
+    }
+    else if (hit && ((fabsf(collision.distance - distance) > 1e-3f*distance) || (Vector3DotProduct(collision.normal, normal) < 0.999f)))
+    {
+        printf("FAILED: %s (distance %f, expected %f | normal %.3f %.3f %.3f)\n", name, collision.distance, distance,
+            collision.normal.x, collision.normal.y, collision.normal.z);
+        failCount++;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_NONE);
+
+    struct { const char *name; float size; Matrix transform; Vector3 normal; } cases[] = {
+        { "tiny mesh scaled up", 0.001f, MatrixScale(1000.0f, 1000.0f, 1000.0f), { 0, 0, 1 } },
+        { "huge mesh scaled down", 1000.0f, MatrixScale(0.001f, 0.001f, 0.001f), { 0, 0, 1 } },
+        { "tiny mesh non uniform scale", 0.001f, MatrixScale(1000.0f, 2000.0f, 0.5f), { 0, 0, 1 } },
+        { "tiny mesh mirrored", 0.001f, MatrixScale(-1000.0f, 1000.0f, 1000.0f), { 0, 0, -1 } },
+        { "tiny mesh rotated and translated", 0.001f, MatrixMultiply(MatrixMultiply(MatrixScale(1000.0f, 1000.0f, 1000.0f),
+            MatrixRotateY(0.3f)), MatrixTranslate(0.0f, 0.0f, -2.0f)), { sinf(0.3f), 0, cosf(0.3f) } },
+    };
+
+    for (int bvh = 0; bvh < 2; bvh++)
+    {
+        for (int i = 0; i < (int)(sizeof(cases)/sizeof(cases[0])); i++)
+        {
+            Mesh mesh = GenMeshQuadXY(cases[i].size);
+            if (bvh) GenMeshBVH(&mesh);
+
+            // Quad covers [-0.5..0.5] in world space (XY), ray pointing to it from +Z
+            Vector3 center = Vector3Transform((Vector3){ 0 }, cases[i].transform);
+            Ray ray = { (Vector3){ center.x + 0.1f, center.y + 0.2f, center.z + 5.0f }, (Vector3){ 0.0f, 0.0f, -1.0f } };
+
+            // Expected distance along ray to quad plane
+            float distance = Vector3DotProduct(Vector3Subtract(center, ray.position), cases[i].normal)/Vector3DotProduct(ray.direction, cases[i].normal);
+            Vector3 normal = (Vector3DotProduct(cases[i].normal, ray.direction) < 0.0f)? cases[i].normal : Vector3Negate(cases[i].normal);
+
+            // NOTE: Mirrored transform flips winding, normal faces the other side
+            if (cases[i].transform.m0 < 0.0f) normal = Vector3Negate(normal);
+
+            CheckRayCollision(TextFormat("%s%s, ray hit", cases[i].name, bvh? " (BVH)" : ""),
+                GetRayCollisionMesh(ray, mesh, cases[i].transform), true, distance, normal);
+
+            // Ray out of quad bounds
+            ray.position.x += 2.0f;
+            CheckRayCollision(TextFormat("%s%s, ray miss", cases[i].name, bvh? " (BVH)" : ""),
+                GetRayCollisionMesh(ray, mesh, cases[i].transform), false, 0.0f, normal);
+
+            UnloadMesh(mesh);
+        }
+    }
+
+    if (failCount > 0) printf("models_ray_collision: %i checks FAILED\n", failCount);
+    else printf("models_ray_collision: all checks passed\n");
+
+    return (failCount > 0)? 1 : 0;
+}
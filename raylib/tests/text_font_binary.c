@@ -0,0 +1,175 @@
+/*******************************************************************************************
+*
+*   raylib [text] test - Binary font loading from truncated and corrupt data
+*
+*   NOTE: Test runs headless (no window required), font atlas is not uploaded to GPU,
+*   LoadFontBinaryFromMemory() must return an empty font for any data not valid
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: calloc(), free()
+#include <string.h>         // Required for: memcpy()
+#include <math.h>           // Required for: NAN
+
+#define GLYPH_COUNT       4
+#define ATLAS_SIZE       16
+
+// Binary font header layout (.rfb), as described in rtext.c
+enum {
+    HEADER_VERSION = 4,
+    HEADER_BASE_SIZE = 8,
+    HEADER_GLYPH_COUNT = 12,
+    HEADER_ATLAS_WIDTH = 24,
+    HEADER_ATLAS_HEIGHT = 28,
+    HEADER_ATLAS_FORMAT = 32,
+    HEADER_KERNING_COUNT = 36,
+    HEADER_GLYPHS_OFFSET = 40,
+    HEADER_RECS_OFFSET = 44,
+    HEADER_KERNING_OFFSET = 48,
+    HEADER_ATLAS_OFFSET = 52,
+    HEADER_ATLAS_DATA_SIZE = 56,
+    HEADER_SIZE = 64
+};
+
+static int failCount = 0;
+
+static void SetInt(unsigned char *data, int offset, int value) { memcpy(data + offset, &value, sizeof(int)); }
+static void SetFloat(unsigned char *data, int offset, float value) { memcpy(data + offset, &value, sizeof(float)); }
+
+// Generate valid binary font data: header, glyphs info, glyphs rectangles and atlas pixels (grayscale)
+static unsigned char *GenFontBinaryData(int *dataSize)
+{
+    int glyphsOffset = HEADER_SIZE;
+    int recsOffset = glyphsOffset + GLYPH_COUNT*16;
+    int atlasOffset = recsOffset + GLYPH_COUNT*16;
+    *dataSize = atlasOffset + ATLAS_SIZE*ATLAS_SIZE;
+
+    unsigned char *data = (unsigned char *)calloc(*dataSize, 1);
+
+    memcpy(data, "rFNB", 4);
+    SetInt(data, HEADER_VERSION, 100);
+    SetInt(data, HEADER_BASE_SIZE, 8);
+    SetInt(data, HEADER_GLYPH_COUNT, GLYPH_COUNT);
+    SetInt(data, HEADER_ATLAS_WIDTH, ATLAS_SIZE);
+    SetInt(data, HEADER_ATLAS_HEIGHT, ATLAS_SIZE);
+    SetInt(data, HEADER_ATLAS_FORMAT, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    SetInt(data, HEADER_GLYPHS_OFFSET, glyphsOffset);
+    SetInt(data, HEADER_RECS_OFFSET, recsOffset);
+    SetInt(data, HEADER_KERNING_OFFSET, atlasOffset);
+    SetInt(data, HEADER_ATLAS_OFFSET, atlasOffset);
+    SetInt(data, HEADER_ATLAS_DATA_SIZE, ATLAS_SIZE*ATLAS_SIZE);
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        SetInt(data, glyphsOffset + 16*i, 'A' + i);     // value
+        SetInt(data, glyphsOffset + 16*i + 12, 8);      // advanceX
+
+        SetFloat(data, recsOffset + 16*i, (float)(8*(i%2)));
+        SetFloat(data, recsOffset + 16*i + 4, (float)(8*(i/2)));
+        SetFloat(data, recsOffset + 16*i + 8, 8.0f);
+        SetFloat(data, recsOffset + 16*i + 12, 8.0f);
+    }
+
+    for (int i = 0; i < ATLAS_SIZE*ATLAS_SIZE; i++) data[atlasOffset + i] = (unsigned char)i;
+
+    return data;
+}
+
+// Check font is loaded or rejected as expected
+static void CheckFontBinary(const char *name, const unsigned char *data, int dataSize, bool expectValid)
+{
+    Font font = LoadFontBinaryFromMemory(data, dataSize);
+
+    // NOTE: Default font is not loaded without a window, rejected data returns an empty font
+    bool valid = (font.glyphs != NULL);
+
+    if (valid != expectValid)
+    {
+        printf("FAILED: %s (expected %s font)\n", name, expectValid? "valid" : "empty");
+        failCount++;
+    }
+
+    if (valid) UnloadFont(font);
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_NONE);
+
+    int dataSize = 0;
+    unsigned char *data = GenFontBinaryData(&dataSize);
+    unsigned char *corrupt = (unsigned char *)malloc(dataSize);
+
+    CheckFontBinary("valid data", data, dataSize, true);
+
+    // Truncated data, every possible size
+    for (int size = 0; size < dataSize; size++)
+    {
+        // NOTE: Truncated data copied into an exact size buffer, out of bounds reads detected with ENABLE_ASAN
+        unsigned char *truncated = (unsigned char *)malloc(size + 1);
+        memcpy(truncated, data, size);
+        CheckFontBinary(TextFormat("truncated data (%i bytes)", size), truncated, size, false);
+        free(truncated);
+    }
+
+    // Corrupt header fields
+    struct { const char *name; int offset; int value; } corruptFields[] = {
+        { "negative glyphs offset", HEADER_GLYPHS_OFFSET, -16 },
+        { "negative recs offset", HEADER_RECS_OFFSET, -64 },
+        { "negative kerning offset", HEADER_KERNING_OFFSET, -1 },
+        { "negative atlas offset", HEADER_ATLAS_OFFSET, -256 },
+        { "glyphs offset overflow", HEADER_GLYPHS_OFFSET, 0x7ffffff0 },
+        { "atlas offset overflow", HEADER_ATLAS_OFFSET, 0x7fffff00 },
+        { "glyph count overflow", HEADER_GLYPH_COUNT, 0x10000001 },
+        { "negative kerning count", HEADER_KERNING_COUNT, -1 },
+        { "kerning count overflow", HEADER_KERNING_COUNT, 0x15555556 },
+        { "negative atlas width", HEADER_ATLAS_WIDTH, -16 },
+        { "negative atlas height", HEADER_ATLAS_HEIGHT, -16 },
+        { "zero base size", HEADER_BASE_SIZE, 0 },
+        { "compressed atlas format", HEADER_ATLAS_FORMAT, PIXELFORMAT_COMPRESSED_DXT1_RGB },
+        { "atlas data size mismatch", HEADER_ATLAS_DATA_SIZE, ATLAS_SIZE*ATLAS_SIZE + 1 },
+        { "version mismatch", HEADER_VERSION, 99 },
+    };
+
+    for (int i = 0; i < (int)(sizeof(corruptFields)/sizeof(corruptFields[0])); i++)
+    {
+        memcpy(corrupt, data, dataSize);
+        SetInt(corrupt, corruptFields[i].offset, corruptFields[i].value);
+        CheckFontBinary(corruptFields[i].name, corrupt, dataSize, false);
+    }
+
+    // Corrupt glyphs rectangles, out of atlas bounds
+    int recsOffset = HEADER_SIZE + GLYPH_COUNT*16;
+    struct { const char *name; int field; float value; } corruptRecs[] = {
+        { "negative rectangle x", 0, -1.0f },
+        { "negative rectangle y", 1, -1.0f },
+        { "rectangle width out of atlas", 2, 17.0f },
+        { "rectangle height out of atlas", 3, 1e9f },
+        { "negative rectangle width", 2, -8.0f },
+        { "rectangle x not a number", 0, NAN },
+    };
+
+    for (int i = 0; i < (int)(sizeof(corruptRecs)/sizeof(corruptRecs[0])); i++)
+    {
+        memcpy(corrupt, data, dataSize);
+        SetFloat(corrupt, recsOffset + 16*(GLYPH_COUNT - 1) + 4*corruptRecs[i].field, corruptRecs[i].value);
+        CheckFontBinary(corruptRecs[i].name, corrupt, dataSize, false);
+    }
+
+    free(corrupt);
+    free(data);
+
+    if (failCount > 0) printf("text_font_binary: %i checks FAILED\n", failCount);
+    else printf("text_font_binary: all checks passed\n");
+
+    return (failCount > 0)? 1 : 0;
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************************
+*
+*   raylib [text] test - Dynamic font drawing with a tiny atlas
+*
+*   NOTE: Test requires a window (hidden) for GPU textures, skipped if it can not be created.
+*   Dynamic font atlas only fits a few glyphs, so drawing a long text evicts glyphs continuously,
+*   text drawn must match the same text drawn with a big enough atlas, including codepoints
+*   not available in font (drawn with fallback glyph, never evicted)
+*
+*   Test licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: abs()
+
+#define TEST_SKIPPED     77         // Test skipped return code (ctest SKIP_RETURN_CODE)
+
+#define FONT_SIZE        16
+#define TARGET_WIDTH   1024
+#define TARGET_HEIGHT    64
+
+static const char *text = "The quick brown fox jumps over the lazy dog 0123456789 \xe4\xb8\xad THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG \xe4\xb8\xad";
+
+typedef enum { DRAW_TEXT_EX = 0, DRAW_TEXT_CODEPOINTS, DRAW_TEXT_LAYOUT } DrawMode;
+
+// Draw text into render texture and get image
+static Image DrawTextImage(RenderTexture2D target, Font font, DrawMode mode)
+{
+    BeginTextureMode(target);
+        ClearBackground(BLANK);
+
+        switch (mode)
+        {
+            case DRAW_TEXT_EX: DrawTextEx(font, text, (Vector2){ 4, 4 }, FONT_SIZE, 0, WHITE); break;
+            case DRAW_TEXT_CODEPOINTS:
+            {
+                int codepointCount = 0;
+                int *codepoints = LoadCodepoints(text, &codepointCount);
+                DrawTextCodepoints(font, codepoints, codepointCount, (Vector2){ 4, 4 }, FONT_SIZE, 0, WHITE);
+                UnloadCodepoints(codepoints);
+            } break;
+            case DRAW_TEXT_LAYOUT:
+            {
+                TextLayout layout = LoadTextLayout(font, text, FONT_SIZE, 0, 0, 0);
+                DrawTextLayout(layout, (Vector2){ 4, 4 }, WHITE);
+                UnloadTextLayout(layout);
+            } break;
+            default: break;
+        }
+    EndTextureMode();
+
+    return LoadImageFromTexture(target.texture);
+}
+
+// Get number of pixels different between two images of same size
+static int GetImageDifference(Image a, Image b)
+{
+    Color *colorsA = LoadImageColors(a);
+    Color *colorsB = LoadImageColors(b);
+    int count = 0;
+
+    for (int i = 0; i < a.width*a.height; i++)
+    {
+        if ((abs(colorsA[i].a - colorsB[i].a) > 8) || (abs(colorsA[i].r - colorsB[i].r) > 8)) count++;
+    }
+
+    UnloadImageColors(colorsA);
+    UnloadImageColors(colorsB);
+
+    return count;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "raylib [text] test - dynamic font");
+
+    if (!IsWindowReady())
+    {
+        printf("text_font_dynamic: SKIPPED (window can not be created)\n");
+        return TEST_SKIPPED;
+    }
+
+    RenderTexture2D target = LoadRenderTexture(TARGET_WIDTH, TARGET_HEIGHT);
+
+    // Reference font, atlas big enough for all text glyphs
+    Font fontReference = LoadFontDynamic(RESOURCES_PATH "anonymous_pro_bold.ttf", FONT_SIZE, 512);
+
+    // Tiny font, atlas only fits a few shelves of glyphs
+    Font fontTiny = LoadFontDynamic(RESOURCES_PATH "anonymous_pro_bold.ttf", FONT_SIZE, 64);
+
+    const char *modeNames[] = { "DrawTextEx()", "DrawTextCodepoints()", "DrawTextLayout()" };
+    int failCount = 0;
+
+    for (int mode = DRAW_TEXT_EX; mode <= DRAW_TEXT_LAYOUT; mode++)
+    {
+        Image reference = DrawTextImage(target, fontReference, mode);
+        Image tiny = DrawTextImage(target, fontTiny, mode);
+
+        int difference = GetImageDifference(reference, tiny);
+
+        if (difference > 0)
+        {
+            printf("FAILED: %s with tiny atlas, %i pixels different\n", modeNames[mode], difference);
+            failCount++;
+        }
+
+        UnloadImage(reference);
+        UnloadImage(tiny);
+    }
+
+    UnloadFont(fontReference);
+    UnloadFont(fontTiny);
+    UnloadRenderTexture(target);
+
+    CloseWindow();
+
+    if (failCount > 0) printf("text_font_dynamic: %i checks FAILED\n", failCount);
+    else printf("text_font_dynamic: all checks passed\n");
+
+    return (failCount > 0)? 1 : 0;
+}